@@ -0,0 +1,301 @@
+/**
+ * @brief Implementation of generic algorithms operating on container iterators.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "utils/pair.h"
+#include "utils/type_traits.h"
+#include "utils/utils.h"
+
+namespace container
+{
+namespace detail
+{
+/**
+ * @brief Refer to an object of given type in unevaluated contexts, such as decltype.
+ *
+ *        The function is never defined, hence it can't be called.
+ *
+ * @tparam T The object type.
+ *
+ * @return Reference to an object of given type.
+ */
+template <typename T>
+T& reference() noexcept;
+} // namespace detail
+
+/**
+ * @brief The type of the elements given iterator type points at, without const qualification.
+ *
+ * @tparam Iterator The iterator type.
+ */
+template <typename Iterator>
+using IteratorValue = typename type_traits::remove_const<typename utils::RemoveReference<
+    decltype(*detail::reference<const Iterator>())>::type>::type;
+
+/**
+ * @brief Get the number of elements in given range.
+ *
+ *        The distance is computed in O(1) for random access iterators, i.e. the iterators of 
+ *        Array, ProgmemArray, Vector, Span etc, and by stepping through the range otherwise.
+ *
+ * @tparam Iterator The iterator type.
+ *
+ * @param[in] first Iterator pointing at the beginning of the range.
+ * @param[in] last  Iterator pointing at the end of the range.
+ *
+ * @return The number of elements in the range.
+ */
+template <typename Iterator>
+size_t distance(const Iterator& first, const Iterator& last) noexcept;
+
+/**
+ * @brief Find the first element in a sorted range that doesn't precede given value.
+ *
+ *        Binary search is used, hence the number of comparisons is O(log n). The number of 
+ *        iterator steps is O(1) per comparison for random access iterators and O(n) in total 
+ *        otherwise.
+ *
+ * @tparam Iterator The iterator type.
+ * @tparam T        The value type.
+ * @tparam Compare  Function object called as compare(element, value), returning true if the 
+ *                  element precedes the value (default = utils::Less<T>).
+ *
+ * @param[in] first   Iterator pointing at the beginning of the range.
+ * @param[in] last    Iterator pointing at the end of the range.
+ * @param[in] value   Reference to the value to search for.
+ * @param[in] compare The comparison function object.
+ *
+ * @return Iterator pointing at the first element not preceding the value, or last if none.
+ */
+template <typename Iterator, typename T, typename Compare = utils::Less<T>>
+Iterator lowerBound(Iterator first, const Iterator& last, const T& value, 
+                    const Compare& compare = Compare{}) noexcept;
+
+/**
+ * @brief Find the first element in a sorted range that given value precedes.
+ *
+ *        Binary search is used, see lowerBound for the complexity.
+ *
+ * @tparam Iterator The iterator type.
+ * @tparam T        The value type.
+ * @tparam Compare  Function object called as compare(value, element), returning true if the 
+ *                  value precedes the element (default = utils::Less<T>).
+ *
+ * @param[in] first   Iterator pointing at the beginning of the range.
+ * @param[in] last    Iterator pointing at the end of the range.
+ * @param[in] value   Reference to the value to search for.
+ * @param[in] compare The comparison function object.
+ *
+ * @return Iterator pointing at the first element the value precedes, or last if none.
+ */
+template <typename Iterator, typename T, typename Compare = utils::Less<T>>
+Iterator upperBound(Iterator first, const Iterator& last, const T& value, 
+                    const Compare& compare = Compare{}) noexcept;
+
+/**
+ * @brief Find the range of elements equivalent to given value in a sorted range.
+ *
+ * @tparam Iterator The iterator type.
+ * @tparam T        The value type.
+ * @tparam Compare  Function object returning true if its first argument precedes its second
+ *                  argument, callable with an element and the value in either order
+ *                  (default = utils::Less<T>).
+ *
+ * @param[in] first   Iterator pointing at the beginning of the range.
+ * @param[in] last    Iterator pointing at the end of the range.
+ * @param[in] value   Reference to the value to search for.
+ * @param[in] compare The comparison function object.
+ *
+ * @return Pair holding the lower bound and the upper bound of the value.
+ */
+template <typename Iterator, typename T, typename Compare = utils::Less<T>>
+utils::Pair<Iterator, Iterator> equalRange(const Iterator& first, const Iterator& last, 
+                                           const T& value, 
+                                           const Compare& compare = Compare{}) noexcept;
+
+/**
+ * @brief Assign given value to each element in given range.
+ *
+ *        Contiguous ranges are filled via utils::fillValues, i.e. via memset where possible.
+ *
+ * @tparam Iterator The iterator type.
+ * @tparam T        The value type.
+ *
+ * @param[in] first Iterator pointing at the beginning of the range.
+ * @param[in] last  Iterator pointing at the end of the range.
+ * @param[in] value Reference to the value to assign.
+ */
+template <typename Iterator, typename T>
+void fill(const Iterator& first, const Iterator& last, const T& value) noexcept;
+
+/**
+ * @brief Sum the elements in given range.
+ *
+ *        Contiguous ranges are processed via pointers in an unrolled loop. The elements are
+ *        added in order, hence floating-point results match a plain loop.
+ *
+ * @tparam Iterator The iterator type.
+ * @tparam T        The result type.
+ *
+ * @param[in] first Iterator pointing at the beginning of the range.
+ * @param[in] last  Iterator pointing at the end of the range.
+ * @param[in] init  The initial value of the sum.
+ *
+ * @return The sum of the initial value and the elements.
+ */
+template <typename Iterator, typename T>
+T accumulate(const Iterator& first, const Iterator& last, T init) noexcept;
+
+/**
+ * @brief Fold the elements in given range via given operation.
+ *
+ *        Contiguous ranges are processed via pointers in an unrolled loop. The elements are
+ *        folded in order.
+ *
+ * @tparam Iterator  The iterator type.
+ * @tparam T         The result type.
+ * @tparam Operation Function object called as operation(result, element).
+ *
+ * @param[in] first     Iterator pointing at the beginning of the range.
+ * @param[in] last      Iterator pointing at the end of the range.
+ * @param[in] init      The initial value of the result.
+ * @param[in] operation The operation to apply.
+ *
+ * @return The result of folding the elements into the initial value.
+ */
+template <typename Iterator, typename T, typename Operation>
+T accumulate(const Iterator& first, const Iterator& last, T init, 
+             const Operation& operation) noexcept;
+
+/**
+ * @brief Store the result of given operation on each element in given range.
+ *
+ *        Contiguous ranges are processed via pointers in an unrolled loop. The destination
+ *        may be the input range itself.
+ *
+ * @tparam InputIterator  The input iterator type.
+ * @tparam OutputIterator The output iterator type.
+ * @tparam Operation      Function object called as operation(element).
+ *
+ * @param[in] first       Iterator pointing at the beginning of the input range.
+ * @param[in] last        Iterator pointing at the end of the input range.
+ * @param[in] destination Iterator pointing at the beginning of the output range.
+ * @param[in] operation   The operation to apply.
+ *
+ * @return Iterator pointing at the end of the output range.
+ */
+template <typename InputIterator, typename OutputIterator, typename Operation>
+OutputIterator transform(const InputIterator& first, const InputIterator& last, 
+                         OutputIterator destination, const Operation& operation) noexcept;
+
+/**
+ * @brief Store the result of given operation on each pair of elements in two ranges.
+ *
+ *        Contiguous ranges are processed via pointers in an unrolled loop. The destination
+ *        may be either input range.
+ *
+ * @tparam InputIterator1 The first input iterator type.
+ * @tparam InputIterator2 The second input iterator type.
+ * @tparam OutputIterator The output iterator type.
+ * @tparam Operation      Function object called as operation(element1, element2).
+ *
+ * @param[in] first1      Iterator pointing at the beginning of the first input range.
+ * @param[in] last1       Iterator pointing at the end of the first input range.
+ * @param[in] first2      Iterator pointing at the beginning of the second input range, which
+ *                        must hold at least as many elements as the first.
+ * @param[in] destination Iterator pointing at the beginning of the output range.
+ * @param[in] operation   The operation to apply.
+ *
+ * @return Iterator pointing at the end of the output range.
+ */
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator, 
+          typename Operation>
+OutputIterator transform(const InputIterator1& first1, const InputIterator1& last1, 
+                         const InputIterator2& first2, OutputIterator destination, 
+                         const Operation& operation) noexcept;
+
+/**
+ * @brief Find the smallest and the largest element in given range in a single pass.
+ *
+ * @tparam Iterator The iterator type.
+ * @tparam Compare  Function object returning true if its first argument precedes its second
+ *                  argument (default = utils::Less).
+ *
+ * @param[in] first   Iterator pointing at the beginning of the range.
+ * @param[in] last    Iterator pointing at the end of the range.
+ * @param[in] compare The comparison function object.
+ *
+ * @return Pair holding iterators pointing at the first smallest and the first largest 
+ *         element, both set to last if the range is empty.
+ */
+template <typename Iterator, typename Compare = utils::Less<IteratorValue<Iterator>>>
+utils::Pair<Iterator, Iterator> minMax(const Iterator& first, const Iterator& last, 
+                                       const Compare& compare = Compare{}) noexcept;
+
+/**
+ * @brief Reorder the elements in given range such that the elements satisfying given 
+ *        predicate precede the elements that don't. The relative order isn't preserved.
+ *
+ *        Each element is tested once, hence the complexity is O(n) for all iterator types.
+ *
+ * @tparam Iterator  The iterator type.
+ * @tparam Predicate Function object called as predicate(element).
+ *
+ * @param[in] first     Iterator pointing at the beginning of the range.
+ * @param[in] last      Iterator pointing at the end of the range.
+ * @param[in] predicate The predicate to test.
+ *
+ * @return Iterator pointing at the first element not satisfying the predicate.
+ */
+template <typename Iterator, typename Predicate>
+Iterator partition(Iterator first, const Iterator& last, const Predicate& predicate) noexcept;
+
+/**
+ * @brief Partially sort the elements in given range such that the element pointed at by 
+ *        nth is the one that would be there if the range was sorted. No element before nth
+ *        succeeds it and no element after nth precedes it.
+ *
+ *        Quickselect is used, which is O(n) on average. This is useful for medians and other
+ *        percentiles without sorting the full range.
+ *
+ * @note The iterators must be contiguous, e.g. those of Array, Vector or Span.
+ *
+ * @tparam Iterator The iterator type.
+ * @tparam Compare  Function object returning true if its first argument precedes its second
+ *                  argument (default = utils::Less).
+ *
+ * @param[in] first   Iterator pointing at the beginning of the range.
+ * @param[in] nth     Iterator pointing at the position to sort.
+ * @param[in] last    Iterator pointing at the end of the range.
+ * @param[in] compare The comparison function object.
+ */
+template <typename Iterator, typename Compare = utils::Less<IteratorValue<Iterator>>>
+void nthElement(const Iterator& first, const Iterator& nth, const Iterator& last,
+                const Compare& compare = Compare{}) noexcept;
+
+/**
+ * @brief Sort the elements in given range.
+ *
+ *        Introsort is used: quicksort with median-of-three pivots, switching to heapsort if 
+ *        the recursion gets too deep and to insertion sort for short ranges. Hence the sort 
+ *        is O(n log n) in the worst case, the recursion depth is O(log n) and no memory is
+ *        allocated. The sort isn't stable. Use List::sort for lists.
+ *
+ * @note The iterators must be contiguous, e.g. those of Array, Vector or Span.
+ *
+ * @tparam Iterator The iterator type.
+ * @tparam Compare  Function object returning true if its first argument precedes its second
+ *                  argument (default = utils::Less).
+ *
+ * @param[in] first   Iterator pointing at the beginning of the range.
+ * @param[in] last    Iterator pointing at the end of the range.
+ * @param[in] compare The comparison function object.
+ */
+template <typename Iterator, typename Compare = utils::Less<IteratorValue<Iterator>>>
+void sort(const Iterator& first, const Iterator& last, const Compare& compare = Compare{}) noexcept;
+} // namespace container
+
+#include "impl/algorithm_impl.h"
@@ -3,6 +3,8 @@
  */
 #pragma once
 
+#include <stddef.h>
+
 #include "utils/utils.h"
 
 namespace container 
@@ -10,6 +12,9 @@ namespace container
 /**
  * @brief Class for implementation of static arrays.
  * 
+ *        Arrays are usable in constant expressions, hence lookup tables can be computed by the 
+ *        compiler, see generate() and makeArray().
+ * 
  * @tparam T    The array type.
  * @tparam Size The array size. Must be greater than 0.
  */
@@ -29,7 +34,7 @@ public:
     /**
      * @brief Create empty array of given size.
      */
-    Array() noexcept;
+    constexpr Array() noexcept;
 
     /**
      * @brief Create array containing given values.
@@ -39,21 +44,21 @@ public:
      * @param[in] values Reference to given values.
      */
     template <typename... Values>
-    explicit Array(const Values&&... values) noexcept;
+    explicit constexpr Array(const Values&&... values) noexcept;
 
     /**
      * @brief Create array containing given values.
      *
      * @param[in] values Reference to given values.
      */
-    explicit Array(const T (&values)[Size]) noexcept;
+    explicit constexpr Array(const T (&values)[Size]) noexcept;
 
     /**
      * @brief Create array as a copy of another array.
      *
      * @param[in] other Reference to other array to copy from.
      */
-    Array(const Array<T, Size>& other) noexcept;
+    constexpr Array(const Array<T, Size>& other) noexcept;
 
     /**
      * @brief Move memory from another array.
@@ -62,13 +67,22 @@ public:
      *
      * @param[in] other Reference to other array to move memory from.
      */
-    Array(Array<T, Size>&& other) noexcept;
+    constexpr Array(Array<T, Size>&& other) noexcept;
 
     /**
      * @brief Delete array.
      */
     ~Array() noexcept = default;
 
+    /**
+     * @brief Copy values from another array of the same size.
+     *
+     * @param[in] other Reference to array holding the values to copy.
+     * 
+     * @return Reference to this array.    
+     */
+    constexpr Array<T, Size>& operator=(const Array<T, Size>& other) noexcept;
+
     /**
      * @brief Copy values from another array.
      *
@@ -79,7 +93,7 @@ public:
      * @return Reference to this array.    
      */
     template <size_t ValueCount>
-    Array<T, Size>& operator=(const Array<T, ValueCount>& other) noexcept;
+    constexpr Array<T, Size>& operator=(const Array<T, ValueCount>& other) noexcept;
 
      /**
      * @brief Move values from another array.
@@ -90,7 +104,7 @@ public:
      * 
      * @return Reference to this array.    
      */
-    Array<T, Size>& operator=(Array<T, Size>&& other) noexcept;
+    constexpr Array<T, Size>& operator=(Array<T, Size>&& other) noexcept;
 
     /**
      * @brief Assign given values to array.
@@ -102,7 +116,7 @@ public:
      * @return Reference to this array.
      */
     template <size_t ValueCount>
-    Array<T, Size>& operator=(const T (&values)[ValueCount]) noexcept;
+    constexpr Array<T, Size>& operator=(const T (&values)[ValueCount]) noexcept;
 
     /**
      * @brief Add values from another array.
@@ -114,7 +128,7 @@ public:
      * @return Reference to this array.     
      */
     template <size_t ValueCount>
-    Array& operator+=(const Array<T, ValueCount>& other) noexcept;
+    constexpr Array& operator+=(const Array<T, ValueCount>& other) noexcept;
 
     /**
      * @brief Add given values to array.
@@ -126,7 +140,7 @@ public:
      * @return Reference to this array.    
      */
     template <size_t ValueCount>
-    Array& operator+=(const T (&values)[ValueCount]) noexcept;
+    constexpr Array& operator+=(const T (&values)[ValueCount]) noexcept;
 
     /**
      * @brief Get element at given index in the array.
@@ -135,7 +149,7 @@ public:
      * 
      * @return Reference to the element at given index.
      */
-    T& operator[](const size_t index) noexcept;
+    constexpr T& operator[](const size_t index) noexcept;
 
     /**
      * @brief Get element at given index in the array.
@@ -144,101 +158,146 @@ public:
      * 
      * @return Reference to the element at given index.
      */
-    const T& operator[](const size_t index) const noexcept;
+    constexpr const T& operator[](const size_t index) const noexcept;
 
     /**
      * @brief Get data held by the array.
      *
      * @return Pointer to the data held by the array.
      */
-    T* data() noexcept;
+    constexpr T* data() noexcept;
 
     /**
      * @brief Get data held by the array.
      *
      * @return Pointer to the data held by the array.
      */
-    T* data() const noexcept;
+    constexpr const T* data() const noexcept;
 
     /**
      * @brief Get the size of the array.
      *
      * @return The size of the array measured in the number of elements it can hold.
      */
-    size_t size() const noexcept;
+    constexpr size_t size() const noexcept;
 
      /**
      * @brief Get the beginning of the array.
      *
      * @return Iterator pointing at the beginning of the array.
      */
-    Iterator begin() noexcept;
+    constexpr Iterator begin() noexcept;
 
     /**
      * @brief Get the beginning of the array.
      *
      * @return Iterator pointing at the beginning of the array.
      */
-    ConstIterator begin() const noexcept;
+    constexpr ConstIterator begin() const noexcept;
 
     /**
      * @brief Get the end of the array.
      *
      * @return Iterator pointing at the end of the array.
      */
-    Iterator end() noexcept;
+    constexpr Iterator end() noexcept;
 
     /**
      * @brief Get the end of the array.
      *
      * @return Iterator pointing at the end of the array.
      */
-    ConstIterator end() const noexcept;
+    constexpr ConstIterator end() const noexcept;
 
     /**
      * @brief Get the reverse beginning of the array.
      *
      * @return Iterator pointing at the reverse beginning of the array.
      */
-    Iterator rbegin() noexcept;
+    constexpr Iterator rbegin() noexcept;
 
     /**
      * @brief Get the reverse beginning of the array.
      *
      * @return Iterator pointing at the reverse beginning of the array.
      */
-    ConstIterator rbegin() const noexcept;
+    constexpr ConstIterator rbegin() const noexcept;
 
     /**
      * @brief Get the reverse end of the array.
      *
      * @return Iterator pointing at the reverse end of the array.
      */
-    Iterator rend() noexcept;
+    constexpr Iterator rend() noexcept;
 
     /**
      * @brief Get the reverse end of the array.
      *
      * @return Iterator pointing at the reverse end of the array.
      */
-    ConstIterator rend() const noexcept;
+    constexpr ConstIterator rend() const noexcept;
 
     /**
      * @brief Clear array content.
      */
-    void clear() noexcept;
+    constexpr void clear() noexcept;
+
+    /**
+     * @brief Assign given value to all elements of the array.
+     *
+     * @param[in] value Reference to the value to assign.
+     */
+    constexpr void fill(const T& value) noexcept;
+
+    /**
+     * @brief Replace each element with the result of given function applied to the element.
+     *
+     * @tparam Function Function object taking an element and returning the new value.
+     * 
+     * @param[in] function The function to apply.
+     */
+    template <typename Function>
+    constexpr void transform(const Function& function) noexcept;
+
+    /**
+     * @brief Assign the result of given generator, called with the index, to each element.
+     *
+     * @tparam Generator Function object taking an index and returning the value at that index.
+     * 
+     * @param[in] generator The generator used to compute the values.
+     */
+    template <typename Generator>
+    constexpr void generate(const Generator& generator) noexcept;
 
 protected:
 
     template <size_t ValueCount>
-    void copy(const T (&values)[ValueCount], const size_t offset = 0U) noexcept;
+    constexpr void copy(const T (&values)[ValueCount], const size_t offset = 0U) noexcept;
     
     template <size_t ValueCount>
-    void copy(const Array<T, ValueCount>& other, const size_t offset = 0U) noexcept;
+    constexpr void copy(const Array<T, ValueCount>& other, const size_t offset = 0U) noexcept;
 
     /** Static field holding data. */
     T myData[Size];
 };
+
+/**
+ * @brief Create array whose elements are computed by given generator.
+ * 
+ *        Used to compute lookup tables at compile time, for instance:
+ * 
+ *            constexpr auto squares{makeArray<uint16_t, 16U>([](size_t i) { return i * i; })};
+ *
+ * @tparam T         The array type.
+ * @tparam Size      The array size.
+ * @tparam Generator Function object taking an index and returning the value at that index.
+ * 
+ * @param[in] generator The generator used to compute the values.
+ * 
+ * @return Array holding the generated values.
+ */
+template <typename T, size_t Size, typename Generator>
+constexpr Array<T, Size> makeArray(const Generator& generator) noexcept;
 } // namespace container
 
 #include "impl/array_impl.h"
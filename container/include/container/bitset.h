@@ -0,0 +1,164 @@
+/**
+ * @brief Implementation of packed fixed-size bit sets.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace container
+{
+/**
+ * @brief Class for implementation of packed fixed-size bit sets.
+ *
+ *        The bits are packed into words, 8-bit words on AVR and 32-bit words otherwise, 
+ *        hence count and the searches process a full word per step. On AVR, the lowest set 
+ *        bit and the number of set bits are looked up per nibble, since the hardware has no 
+ *        bit scan instructions; on other targets, compiler builtins are used.
+ *
+ *        Use a bit set to keep track of reserved resources, e.g. pins or timer circuits, and
+ *        findFirstReset to pick a free one.
+ *
+ * @tparam N The number of bits. Must be greater than 0.
+ */
+template <size_t N>
+class Bitset
+{
+    static_assert(N > 0U, "Bitset size must be greater than 0!");
+
+public:
+#ifdef __AVR__
+    /** Word holding bits, sized to match the AVR registers. */
+    using Word = uint8_t;
+#else
+    /** Word holding bits. */
+    using Word = uint32_t;
+#endif
+
+    /**
+     * @brief Create bit set with all bits reset.
+     */
+    constexpr Bitset() noexcept;
+
+    /**
+     * @brief Delete bit set.
+     */
+    ~Bitset() noexcept = default;
+
+    /**
+     * @brief Check if given bit is set.
+     *
+     * @param[in] index Index of the bit.
+     *
+     * @return True if the bit is set, false if it's reset or the index is out of range.
+     */
+    constexpr bool operator[](const size_t index) const noexcept { return test(index); }
+
+    /**
+     * @brief Check if given bit is set.
+     *
+     * @param[in] index Index of the bit.
+     *
+     * @return True if the bit is set, false if it's reset or the index is out of range.
+     */
+    constexpr bool test(const size_t index) const noexcept;
+
+    /**
+     * @brief Set given bit.
+     *
+     * @param[in] index Index of the bit. Indexes out of range are ignored.
+     */
+    constexpr void set(const size_t index) noexcept;
+
+    /**
+     * @brief Reset given bit.
+     *
+     * @param[in] index Index of the bit. Indexes out of range are ignored.
+     */
+    constexpr void reset(const size_t index) noexcept;
+
+    /**
+     * @brief Toggle given bit.
+     *
+     * @param[in] index Index of the bit. Indexes out of range are ignored.
+     */
+    constexpr void flip(const size_t index) noexcept;
+
+    /**
+     * @brief Set all bits.
+     */
+    constexpr void set() noexcept;
+
+    /**
+     * @brief Reset all bits.
+     */
+    constexpr void reset() noexcept;
+
+    /**
+     * @brief Get the number of set bits.
+     *
+     * @return The number of set bits.
+     */
+    constexpr size_t count() const noexcept;
+
+    /**
+     * @brief Check if any bit is set.
+     *
+     * @return True if any bit is set, false otherwise.
+     */
+    constexpr bool any() const noexcept;
+
+    /**
+     * @brief Check if all bits are set.
+     *
+     * @return True if all bits are set, false otherwise.
+     */
+    constexpr bool all() const noexcept;
+
+    /**
+     * @brief Find the first set bit.
+     *
+     * @return Index of the first set bit, or N if no bit is set.
+     */
+    constexpr size_t findFirstSet() const noexcept;
+
+    /**
+     * @brief Find the first set bit after given bit.
+     *
+     * @param[in] index Index of the bit to search after.
+     *
+     * @return Index of the next set bit, or N if no bit after given bit is set.
+     */
+    constexpr size_t findNextSet(const size_t index) const noexcept;
+
+    /**
+     * @brief Find the first reset bit, e.g. the first free resource.
+     *
+     * @return Index of the first reset bit, or N if all bits are set.
+     */
+    constexpr size_t findFirstReset() const noexcept;
+
+    /**
+     * @brief Get the size of the bit set.
+     *
+     * @return The number of bits.
+     */
+    static constexpr size_t size() noexcept { return N; }
+
+private:
+    static constexpr size_t WordBits{8U * sizeof(Word)};
+    static constexpr size_t WordCount{(N + WordBits - 1U) / WordBits};
+    static constexpr Word LastWordMask{N % WordBits == 0U ? static_cast<Word>(~Word{}) 
+        : static_cast<Word>((Word{1U} << (N % WordBits)) - 1U)};
+
+    static constexpr Word mask(const size_t index) noexcept;
+    static constexpr size_t lowestSetBit(const Word word) noexcept;
+    static constexpr size_t setBitCount(const Word word) noexcept;
+    constexpr size_t findSet(size_t wordIndex, Word word) const noexcept;
+
+    /** Words holding the bits, bits beyond N are always reset. */
+    Word myWords[WordCount];
+};
+} // namespace container
+
+#include "impl/bitset_impl.h"
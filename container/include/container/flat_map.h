@@ -0,0 +1,170 @@
+/**
+ * @brief Implementation of fixed-capacity hash maps with open addressing.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "container/array.h"
+#include "utils/pair.h"
+#include "utils/utils.h"
+
+namespace container
+{
+/**
+ * @brief Class for implementation of fixed-capacity hash maps.
+ *
+ *        The entries are stored in place in a single array of N slots, hence no dynamic memory
+ *        is used and lookups touch consecutive memory. Collisions are resolved via linear 
+ *        probing and removed entries are replaced by shifting the following entries back, 
+ *        hence no tombstones accumulate. Lookup, insertion and removal are O(1) on average 
+ *        and O(N) in the worst case.
+ *
+ *        Keep the map at most about three quarters full for short probe sequences. With the
+ *        default hash, keys in the range [0, N) never collide.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam K    The key type. Must be default constructible and equality comparable.
+ * @tparam V    The value type. Must be default constructible.
+ * @tparam N    The capacity of the map. Must be greater than 0.
+ * @tparam Hash Function object returning the hash of a key (default = utils::Hash<K>).
+ */
+template <typename K, typename V, size_t N, typename Hash = utils::Hash<K>>
+class FlatMap
+{
+    static_assert(N > 0U, "Flat map capacity must be greater than 0!");
+
+public:
+    /**
+     * @brief Create empty map.
+     */
+    FlatMap() noexcept;
+
+    /**
+     * @brief Delete map.
+     */
+    ~FlatMap() noexcept = default;
+
+    /**
+     * @brief Find the value associated with given key.
+     *
+     * @param[in] key Reference to the key.
+     *
+     * @return Pointer to the value, or a nullptr if the key isn't present.
+     */
+    V* find(const K& key) noexcept;
+
+    /**
+     * @brief Find the value associated with given key.
+     *
+     * @param[in] key Reference to the key.
+     *
+     * @return Pointer to the value, or a nullptr if the key isn't present.
+     */
+    const V* find(const K& key) const noexcept;
+
+    /**
+     * @brief Check if given key is present in the map.
+     *
+     * @param[in] key Reference to the key.
+     *
+     * @return True if the key is present, false otherwise.
+     */
+    bool contains(const K& key) const noexcept;
+
+    /**
+     * @brief Associate given value with given key. The value of a present key is replaced.
+     *
+     * @param[in] key   Reference to the key.
+     * @param[in] value Reference to the value.
+     *
+     * @return True if the value was stored, false if the key is new and the map is full.
+     */
+    bool insert(const K& key, const V& value) noexcept;
+
+    /**
+     * @brief Associate given value with given key. The value of a present key is replaced.
+     *
+     * @param[in] key   Reference to the key.
+     * @param[in] value Reference to the value to move.
+     *
+     * @return True if the value was stored, false if the key is new and the map is full.
+     */
+    bool insert(const K& key, V&& value) noexcept;
+
+    /**
+     * @brief Remove given key and its associated value.
+     *
+     * @param[in] key Reference to the key.
+     *
+     * @return True if the key was removed, false if it wasn't present.
+     */
+    bool remove(const K& key) noexcept;
+
+    /**
+     * @brief Remove all entries of the map.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Call given function for each entry of the map, in storage order.
+     *
+     * @tparam Function Function object callable as function(const K& key, V& value).
+     *
+     * @param[in] function The function to call.
+     */
+    template <typename Function>
+    void forEach(const Function& function) noexcept;
+
+    /**
+     * @brief Get the number of entries in the map.
+     *
+     * @return The number of entries in the map.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Get the capacity of the map.
+     *
+     * @return The maximum number of entries the map can hold.
+     */
+    static constexpr size_t capacity() noexcept { return N; }
+
+    /**
+     * @brief Check if the map is empty.
+     *
+     * @return True if the map is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Check if the map is full.
+     *
+     * @return True if the map is full, false otherwise.
+     */
+    bool full() const noexcept;
+
+    FlatMap(const FlatMap&)            = delete; // No copy constructor.
+    FlatMap(FlatMap&&)                 = delete; // No move constructor.
+    FlatMap& operator=(const FlatMap&) = delete; // No copy assignment.
+    FlatMap& operator=(FlatMap&&)      = delete; // No move assignment.
+
+private:
+    static size_t homeSlot(const K& key) noexcept;
+    static size_t nextSlot(const size_t slot) noexcept;
+    size_t findSlot(const K& key) const noexcept;
+    size_t freeSlot(const K& key) const noexcept;
+
+    /** Slots holding the entries. */
+    Array<utils::Pair<K, V>, N> mySlots;
+
+    /** Slot occupation (true = used, false = free). */
+    Array<bool, N> myUsed;
+
+    /** The number of entries in the map. */
+    size_t mySize;
+};
+} // namespace container
+
+#include "impl/flat_map_impl.h"
@@ -0,0 +1,494 @@
+/**
+ * @brief Implementation details of container algorithms.
+ *
+ * @note Don't include this header, use <algorithm.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+namespace detail
+{
+/**
+ * @brief Check if given iterator type supports random access, i.e. subtraction of iterators.
+ *
+ * @tparam Iterator The iterator type.
+ */
+template <typename Iterator, typename = void>
+struct IsRandomAccess
+{
+    // False unless the specialization below is viable.
+    static constexpr bool value{false};
+};
+
+/**
+ * @brief Specialization for iterator types supporting subtraction.
+ *
+ * @tparam Iterator The iterator type.
+ */
+template <typename Iterator>
+struct IsRandomAccess<Iterator, decltype(void(reference<const Iterator>() - 
+                                              reference<const Iterator>()))>
+{
+    // True for random access iterators.
+    static constexpr bool value{true};
+};
+
+/**
+ * @brief Check if given iterator type is contiguous, i.e. supports random access and refers
+ *        to elements stored in memory, whose addresses can be taken.
+ *
+ * @tparam Iterator The iterator type.
+ */
+template <typename Iterator, typename = void>
+struct IsContiguous
+{
+    // False unless the specialization below is viable.
+    static constexpr bool value{false};
+};
+
+/**
+ * @brief Specialization for iterator types referring to elements in memory.
+ *
+ * @tparam Iterator The iterator type.
+ */
+template <typename Iterator>
+struct IsContiguous<Iterator, decltype(void(&*reference<const Iterator>()))>
+{
+    // True for random access iterators referring to elements in memory.
+    static constexpr bool value{IsRandomAccess<Iterator>::value};
+};
+
+/** Ranges of this size or shorter are sorted via insertion sort. */
+constexpr size_t insertionSortThreshold{16U};
+
+// -----------------------------------------------------------------------------
+template <typename Iterator>
+auto address(Iterator iterator) noexcept
+{
+    return &*iterator;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Value, typename Operation>
+Value accumulate(const T* data, const size_t count, Value value, 
+                 const Operation& operation) noexcept
+{
+    // Process four elements per iteration to cut the loop overhead, in order.
+    size_t i{};
+    for (; i + 4U <= count; i += 4U)
+    {
+        value = operation(value, data[i]);
+        value = operation(value, data[i + 1U]);
+        value = operation(value, data[i + 2U]);
+        value = operation(value, data[i + 3U]);
+    }
+    for (; i < count; ++i) { value = operation(value, data[i]); }
+    return value;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename U, typename Operation>
+void transform(const T* data, const size_t count, U* destination, 
+               const Operation& operation) noexcept
+{
+    size_t i{};
+    for (; i + 4U <= count; i += 4U)
+    {
+        destination[i]      = operation(data[i]);
+        destination[i + 1U] = operation(data[i + 1U]);
+        destination[i + 2U] = operation(data[i + 2U]);
+        destination[i + 3U] = operation(data[i + 3U]);
+    }
+    for (; i < count; ++i) { destination[i] = operation(data[i]); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T1, typename T2, typename U, typename Operation>
+void transform(const T1* data1, const T2* data2, const size_t count, U* destination, 
+               const Operation& operation) noexcept
+{
+    size_t i{};
+    for (; i + 4U <= count; i += 4U)
+    {
+        destination[i]      = operation(data1[i], data2[i]);
+        destination[i + 1U] = operation(data1[i + 1U], data2[i + 1U]);
+        destination[i + 2U] = operation(data1[i + 2U], data2[i + 2U]);
+        destination[i + 3U] = operation(data1[i + 3U], data2[i + 3U]);
+    }
+    for (; i < count; ++i) { destination[i] = operation(data1[i], data2[i]); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+void insertionSort(T* data, const size_t count, const Compare& compare) noexcept
+{
+    for (size_t i{1U}; i < count; ++i)
+    {
+        T value{utils::move(data[i])};
+        auto j{i};
+
+        for (; (j > 0U) && compare(value, data[j - 1U]); --j) 
+        { 
+            data[j] = utils::move(data[j - 1U]); 
+        }
+        data[j] = utils::move(value);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+void siftDown(T* data, size_t index, const size_t count, const Compare& compare) noexcept
+{
+    // Move the largest children up until the hole is where the value belongs.
+    T value{utils::move(data[index])};
+
+    while (true)
+    {
+        auto child{2U * index + 1U};
+        if (child >= count) { break; }
+        if ((child + 1U < count) && compare(data[child], data[child + 1U])) { ++child; }
+        if (!compare(value, data[child])) { break; }
+        data[index] = utils::move(data[child]);
+        index       = child;
+    }
+    data[index] = utils::move(value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+void heapSort(T* data, const size_t count, const Compare& compare) noexcept
+{
+    for (auto i{count / 2U}; i > 0U; --i) { siftDown(data, i - 1U, count, compare); }
+
+    for (auto end{count}; end > 1U; --end)
+    {
+        utils::swap(data[0U], data[end - 1U]);
+        siftDown(data, 0U, end - 1U, compare);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+size_t partitionAroundPivot(T* data, const size_t count, const Compare& compare) noexcept
+{
+    // Sort the first, middle and last element, then use the median as pivot at the front.
+    // The last element then stops the forward scan and the pivot stops the backward scan.
+    const auto middle{count / 2U};
+    const auto last{count - 1U};
+    if (compare(data[middle], data[0U])) { utils::swap(data[middle], data[0U]); }
+    if (compare(data[last], data[0U]))   { utils::swap(data[last], data[0U]); }
+    if (compare(data[last], data[middle])) { utils::swap(data[last], data[middle]); }
+    utils::swap(data[0U], data[middle]);
+
+    // Elements equal to the pivot stop both scans, which splits runs of duplicates evenly.
+    size_t i{};
+    auto j{count};
+
+    while (true)
+    {
+        do { ++i; } while (compare(data[i], data[0U]));
+        do { --j; } while (compare(data[0U], data[j]));
+        if (i >= j) { break; }
+        utils::swap(data[i], data[j]);
+    }
+    utils::swap(data[0U], data[j]);
+    return j;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+void introSort(T* data, size_t count, size_t depthLimit, const Compare& compare) noexcept
+{
+    while (count > insertionSortThreshold)
+    {
+        if (depthLimit-- == 0U) 
+        { 
+            heapSort(data, count, compare);
+            return;
+        }
+        const auto pivot{partitionAroundPivot(data, count, compare)};
+        const auto rightCount{count - pivot - 1U};
+
+        // Recurse into the smaller part and loop on the larger part to bound the stack depth.
+        if (pivot < rightCount)
+        {
+            introSort(data, pivot, depthLimit, compare);
+            data  += pivot + 1U;
+            count  = rightCount;
+        }
+        else
+        {
+            introSort(data + pivot + 1U, rightCount, depthLimit, compare);
+            count = pivot;
+        }
+    }
+    insertionSort(data, count, compare);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+void nthElement(T* data, size_t count, size_t nth, const Compare& compare) noexcept
+{
+    while (count > insertionSortThreshold)
+    {
+        const auto pivot{partitionAroundPivot(data, count, compare)};
+        if (pivot == nth) { return; }
+
+        // Continue in the part holding the requested position only.
+        if (nth < pivot) { count = pivot; }
+        else
+        {
+            data  += pivot + 1U;
+            count -= pivot + 1U;
+            nth   -= pivot + 1U;
+        }
+    }
+    insertionSort(data, count, compare);
+}
+
+// -----------------------------------------------------------------------------
+constexpr size_t log2(size_t value) noexcept
+{
+    size_t result{};
+    while (value > 1U)
+    {
+        value >>= 1U;
+        ++result;
+    }
+    return result;
+}
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <typename Iterator>
+size_t distance(const Iterator& first, const Iterator& last) noexcept
+{
+    if constexpr (detail::IsRandomAccess<Iterator>::value) 
+    { 
+        return static_cast<size_t>(last - first); 
+    }
+    else
+    {
+        size_t count{};
+        for (auto i{first}; i != last; ++i) { ++count; }
+        return count;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename T, typename Compare>
+Iterator lowerBound(Iterator first, const Iterator& last, const T& value, 
+                    const Compare& compare) noexcept
+{
+    auto count{distance(first, last)};
+
+    while (count > 0U)
+    {
+        const auto step{count / 2U};
+        auto middle{first};
+        middle += step;
+
+        if (compare(*middle, value))
+        {
+            first = middle;
+            ++first;
+            count -= step + 1U;
+        }
+        else { count = step; }
+    }
+    return first;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename T, typename Compare>
+Iterator upperBound(Iterator first, const Iterator& last, const T& value, 
+                    const Compare& compare) noexcept
+{
+    auto count{distance(first, last)};
+
+    while (count > 0U)
+    {
+        const auto step{count / 2U};
+        auto middle{first};
+        middle += step;
+
+        if (!compare(value, *middle))
+        {
+            first = middle;
+            ++first;
+            count -= step + 1U;
+        }
+        else { count = step; }
+    }
+    return first;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename T, typename Compare>
+utils::Pair<Iterator, Iterator> equalRange(const Iterator& first, const Iterator& last, 
+                                           const T& value, const Compare& compare) noexcept
+{
+    const auto lower{lowerBound(first, last, value, compare)};
+    return utils::Pair<Iterator, Iterator>{lower, upperBound(lower, last, value, compare)};
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename T>
+void fill(const Iterator& first, const Iterator& last, const T& value) noexcept
+{
+    if constexpr (detail::IsContiguous<Iterator>::value)
+    {
+        const auto count{distance(first, last)};
+        if (count > 0U) 
+        { 
+            utils::fillValues(detail::address(first), static_cast<IteratorValue<Iterator>>(value), 
+                              count); 
+        }
+    }
+    else
+    {
+        for (auto i{first}; i != last; ++i) { *i = value; }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename T>
+T accumulate(const Iterator& first, const Iterator& last, T init) noexcept
+{
+    return accumulate(first, last, init, [](const T& sum, const IteratorValue<Iterator>& value) 
+    { 
+        return sum + value; 
+    });
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename T, typename Operation>
+T accumulate(const Iterator& first, const Iterator& last, T init, 
+             const Operation& operation) noexcept
+{
+    if constexpr (detail::IsContiguous<Iterator>::value)
+    {
+        const auto count{distance(first, last)};
+        return count > 0U ? detail::accumulate(detail::address(first), count, init, operation) 
+                          : init;
+    }
+    else
+    {
+        for (auto i{first}; i != last; ++i) { init = operation(init, *i); }
+        return init;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename InputIterator, typename OutputIterator, typename Operation>
+OutputIterator transform(const InputIterator& first, const InputIterator& last, 
+                         OutputIterator destination, const Operation& operation) noexcept
+{
+    if constexpr (detail::IsContiguous<InputIterator>::value && 
+                  detail::IsContiguous<OutputIterator>::value)
+    {
+        const auto count{distance(first, last)};
+        if (count > 0U)
+        {
+            detail::transform(detail::address(first), count, detail::address(destination), 
+                              operation);
+            destination += count;
+        }
+    }
+    else
+    {
+        for (auto i{first}; i != last; ++i, ++destination) { *destination = operation(*i); }
+    }
+    return destination;
+}
+
+// -----------------------------------------------------------------------------
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator, 
+          typename Operation>
+OutputIterator transform(const InputIterator1& first1, const InputIterator1& last1, 
+                         const InputIterator2& first2, OutputIterator destination, 
+                         const Operation& operation) noexcept
+{
+    if constexpr (detail::IsContiguous<InputIterator1>::value && 
+                  detail::IsContiguous<InputIterator2>::value && 
+                  detail::IsContiguous<OutputIterator>::value)
+    {
+        const auto count{distance(first1, last1)};
+        if (count > 0U)
+        {
+            detail::transform(detail::address(first1), detail::address(first2), count, 
+                              detail::address(destination), operation);
+            destination += count;
+        }
+    }
+    else
+    {
+        auto j{first2};
+        for (auto i{first1}; i != last1; ++i, ++j, ++destination) 
+        { 
+            *destination = operation(*i, *j); 
+        }
+    }
+    return destination;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename Compare>
+utils::Pair<Iterator, Iterator> minMax(const Iterator& first, const Iterator& last, 
+                                       const Compare& compare) noexcept
+{
+    auto min{first};
+    auto max{first};
+    if (first == last) { return utils::Pair<Iterator, Iterator>{min, max}; }
+
+    for (auto i{first}; ++i != last;)
+    {
+        if (compare(*i, *min)) { min = i; }
+        else if (compare(*max, *i)) { max = i; }
+    }
+    return utils::Pair<Iterator, Iterator>{min, max};
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename Predicate>
+Iterator partition(Iterator first, const Iterator& last, const Predicate& predicate) noexcept
+{
+    // Skip the leading elements already in place, then swap each match to the front.
+    while ((first != last) && predicate(*first)) { ++first; }
+    if (first == last) { return first; }
+
+    for (auto i{first}; ++i != last;)
+    {
+        if (predicate(*i))
+        {
+            utils::swap(*i, *first);
+            ++first;
+        }
+    }
+    return first;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename Compare>
+void nthElement(const Iterator& first, const Iterator& nth, const Iterator& last,
+                const Compare& compare) noexcept
+{
+    static_assert(detail::IsContiguous<Iterator>::value, 
+                  "nthElement requires contiguous iterators!");
+    const auto count{distance(first, last)};
+    const auto index{distance(first, nth)};
+    if (index >= count) { return; }
+    detail::nthElement(detail::address(first), count, index, compare);
+}
+
+// -----------------------------------------------------------------------------
+template <typename Iterator, typename Compare>
+void sort(const Iterator& first, const Iterator& last, const Compare& compare) noexcept
+{
+    static_assert(detail::IsContiguous<Iterator>::value, "sort requires contiguous iterators!");
+    const auto count{distance(first, last)};
+    if (count < 2U) { return; }
+    detail::introSort(detail::address(first), count, 2U * detail::log2(count), compare);
+}
+} // namespace container
@@ -0,0 +1,178 @@
+/**
+ * @brief Implementation details of container::Bitset class.
+ *
+ * @note Don't include this header, use <bitset.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+#ifdef __AVR__
+namespace detail
+{
+/** Index of the lowest set bit of each nibble value (0 for value 0, which is never used). */
+constexpr uint8_t lowestSetBitInNibble[16U]{0U, 0U, 1U, 0U, 2U, 0U, 1U, 0U, 
+                                            3U, 0U, 1U, 0U, 2U, 0U, 1U, 0U};
+
+/** The number of set bits of each nibble value. */
+constexpr uint8_t setBitCountInNibble[16U]{0U, 1U, 1U, 2U, 1U, 2U, 2U, 3U, 
+                                           1U, 2U, 2U, 3U, 2U, 3U, 3U, 4U};
+} // namespace detail
+#endif
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr Bitset<N>::Bitset() noexcept
+    : myWords{} {}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr bool Bitset<N>::test(const size_t index) const noexcept
+{
+    return (index < N) && ((myWords[index / WordBits] & mask(index)) != 0U);
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr void Bitset<N>::set(const size_t index) noexcept
+{
+    if (index < N) { myWords[index / WordBits] |= mask(index); }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr void Bitset<N>::reset(const size_t index) noexcept
+{
+    if (index < N) { myWords[index / WordBits] &= static_cast<Word>(~mask(index)); }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr void Bitset<N>::flip(const size_t index) noexcept
+{
+    if (index < N) { myWords[index / WordBits] ^= mask(index); }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr void Bitset<N>::set() noexcept
+{
+    for (size_t i{}; i + 1U < WordCount; ++i) { myWords[i] = static_cast<Word>(~Word{}); }
+    myWords[WordCount - 1U] = LastWordMask;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr void Bitset<N>::reset() noexcept
+{
+    for (size_t i{}; i < WordCount; ++i) { myWords[i] = 0U; }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr size_t Bitset<N>::count() const noexcept
+{
+    size_t result{};
+    for (size_t i{}; i < WordCount; ++i) { result += setBitCount(myWords[i]); }
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr bool Bitset<N>::any() const noexcept
+{
+    for (size_t i{}; i < WordCount; ++i)
+    {
+        if (myWords[i] != 0U) { return true; }
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr bool Bitset<N>::all() const noexcept
+{
+    for (size_t i{}; i + 1U < WordCount; ++i)
+    {
+        if (myWords[i] != static_cast<Word>(~Word{})) { return false; }
+    }
+    return myWords[WordCount - 1U] == LastWordMask;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr size_t Bitset<N>::findFirstSet() const noexcept
+{
+    return findSet(0U, myWords[0U]);
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr size_t Bitset<N>::findNextSet(const size_t index) const noexcept
+{
+    const auto next{index + 1U};
+    if (next >= N) { return N; }
+
+    // Mask out the bits up to and including given bit in its word, then search from there.
+    const auto wordIndex{next / WordBits};
+    const auto word{static_cast<Word>(myWords[wordIndex] & ~(mask(next) - 1U))};
+    return findSet(wordIndex, word);
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr size_t Bitset<N>::findFirstReset() const noexcept
+{
+    for (size_t i{}; i < WordCount; ++i)
+    {
+        const auto validBits{i + 1U < WordCount ? static_cast<Word>(~Word{}) : LastWordMask};
+        const auto resetBits{static_cast<Word>(~myWords[i] & validBits)};
+        if (resetBits != 0U) { return i * WordBits + lowestSetBit(resetBits); }
+    }
+    return N;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr typename Bitset<N>::Word Bitset<N>::mask(const size_t index) noexcept
+{
+    return static_cast<Word>(Word{1U} << (index % WordBits));
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr size_t Bitset<N>::lowestSetBit(const Word word) noexcept
+{
+#ifdef __AVR__
+    const auto lowNibble{static_cast<uint8_t>(word & 0x0FU)};
+    return lowNibble != 0U ? detail::lowestSetBitInNibble[lowNibble] 
+                           : 4U + detail::lowestSetBitInNibble[word >> 4U];
+#else
+    return static_cast<size_t>(__builtin_ctz(word));
+#endif
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr size_t Bitset<N>::setBitCount(const Word word) noexcept
+{
+#ifdef __AVR__
+    return detail::setBitCountInNibble[word & 0x0FU] + detail::setBitCountInNibble[word >> 4U];
+#else
+    return static_cast<size_t>(__builtin_popcount(word));
+#endif
+}
+
+// -----------------------------------------------------------------------------
+template <size_t N>
+constexpr size_t Bitset<N>::findSet(size_t wordIndex, Word word) const noexcept
+{
+    // Skip empty words, then locate the lowest set bit of the first non-empty word.
+    while (word == 0U)
+    {
+        if (++wordIndex >= WordCount) { return N; }
+        word = myWords[wordIndex];
+    }
+    return wordIndex * WordBits + lowestSetBit(word);
+}
+} // namespace container
@@ -0,0 +1,167 @@
+/**
+ * @brief Implementation details of container::FlatMap class.
+ *
+ * @note Don't include this header, use <flat_map.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+FlatMap<K, V, N, Hash>::FlatMap() noexcept
+    : mySlots{}
+    , myUsed{}
+    , mySize{} {}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+V* FlatMap<K, V, N, Hash>::find(const K& key) noexcept
+{
+    const auto slot{findSlot(key)};
+    return slot < N ? &mySlots[slot].second : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+const V* FlatMap<K, V, N, Hash>::find(const K& key) const noexcept
+{
+    const auto slot{findSlot(key)};
+    return slot < N ? &mySlots[slot].second : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+bool FlatMap<K, V, N, Hash>::contains(const K& key) const noexcept
+{
+    return findSlot(key) < N;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+bool FlatMap<K, V, N, Hash>::insert(const K& key, const V& value) noexcept
+{
+    V copy{value};
+    return insert(key, utils::move(copy));
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+bool FlatMap<K, V, N, Hash>::insert(const K& key, V&& value) noexcept
+{
+    // Replace the value of a present key, else take the first free slot of the probe sequence.
+    auto slot{findSlot(key)};
+    if (slot == N)
+    {
+        slot = freeSlot(key);
+        if (slot == N) { return false; }
+        mySlots[slot].first = key;
+        myUsed[slot]        = true;
+        mySize++;
+    }
+    mySlots[slot].second = utils::move(value);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+bool FlatMap<K, V, N, Hash>::remove(const K& key) noexcept
+{
+    auto hole{findSlot(key)};
+    if (hole == N) { return false; }
+    myUsed[hole] = false;
+
+    // Shift back the following entries of the cluster that may not be placed after the hole,
+    // i.e. those whose home slot isn't cyclically within (hole, slot].
+    for (auto slot{nextSlot(hole)}; myUsed[slot]; slot = nextSlot(slot))
+    {
+        const auto home{homeSlot(mySlots[slot].first)};
+        const bool stays{hole <= slot ? (hole < home) && (home <= slot) 
+                                      : (hole < home) || (home <= slot)};
+        if (stays) { continue; }
+        mySlots[hole] = utils::move(mySlots[slot]);
+        myUsed[hole]  = true;
+        myUsed[slot]  = false;
+        hole          = slot;
+    }
+    mySlots[hole] = utils::Pair<K, V>{};
+    mySize--;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+void FlatMap<K, V, N, Hash>::clear() noexcept
+{
+    for (size_t i{}; i < N; ++i)
+    {
+        if (myUsed[i]) { mySlots[i] = utils::Pair<K, V>{}; }
+        myUsed[i] = false;
+    }
+    mySize = 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+template <typename Function>
+void FlatMap<K, V, N, Hash>::forEach(const Function& function) noexcept
+{
+    for (size_t i{}; i < N; ++i)
+    {
+        if (myUsed[i]) { function(static_cast<const K&>(mySlots[i].first), mySlots[i].second); }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+size_t FlatMap<K, V, N, Hash>::size() const noexcept { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+bool FlatMap<K, V, N, Hash>::empty() const noexcept { return mySize == 0U; }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+bool FlatMap<K, V, N, Hash>::full() const noexcept { return mySize == N; }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+size_t FlatMap<K, V, N, Hash>::homeSlot(const K& key) noexcept
+{
+    return Hash{}(key) % N;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+size_t FlatMap<K, V, N, Hash>::nextSlot(const size_t slot) noexcept
+{
+    return slot + 1U < N ? slot + 1U : 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+size_t FlatMap<K, V, N, Hash>::findSlot(const K& key) const noexcept
+{
+    // Probe until the key or a free slot is found, a free slot ending the cluster.
+    auto slot{homeSlot(key)};
+    for (size_t i{}; (i < N) && myUsed[slot]; ++i)
+    {
+        if (mySlots[slot].first == key) { return slot; }
+        slot = nextSlot(slot);
+    }
+    return N;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, size_t N, typename Hash>
+size_t FlatMap<K, V, N, Hash>::freeSlot(const K& key) const noexcept
+{
+    auto slot{homeSlot(key)};
+    for (size_t i{}; i < N; ++i)
+    {
+        if (!myUsed[slot]) { return slot; }
+        slot = nextSlot(slot);
+    }
+    return N;
+}
+} // namespace container
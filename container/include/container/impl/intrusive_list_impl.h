@@ -0,0 +1,230 @@
+/**
+ * @brief Implementation details of container::IntrusiveList class.
+ *
+ * @note Don't include this header, use <intrusive_list.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+/**
+ * @brief Accessor to the links and elements of the hooks, used by the iterators.
+ * 
+ * @tparam T The element type.
+ */
+template <typename T>
+struct IntrusiveList<T>::HookAccess
+{
+    using Node  = IntrusiveListHook; // The node type.
+    using Value = T;                 // The element type.
+
+    static Node* next(const Node& hook) noexcept { return hook.myNext; }
+    static Node* previous(const Node& hook) noexcept { return hook.myPrevious; }
+    static T& value(Node& hook) noexcept { return static_cast<T&>(hook); }
+    static const T& value(const Node& hook) noexcept { return static_cast<const T&>(hook); }
+};
+
+// -----------------------------------------------------------------------------
+template <typename T>
+IntrusiveList<T>::IntrusiveList() noexcept
+    : myRoot{}
+    , mySize{}
+{
+    myRoot.myPrevious = &myRoot;
+    myRoot.myNext     = &myRoot;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+IntrusiveList<T>::~IntrusiveList() noexcept { clear(); }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t IntrusiveList<T>::size() const noexcept { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool IntrusiveList<T>::empty() const noexcept { return mySize == 0U; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* IntrusiveList<T>::front() noexcept
+{
+    return mySize > 0U ? static_cast<T*>(myRoot.myNext) : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+const T* IntrusiveList<T>::front() const noexcept
+{
+    return mySize > 0U ? static_cast<const T*>(myRoot.myNext) : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* IntrusiveList<T>::back() noexcept
+{
+    return mySize > 0U ? static_cast<T*>(myRoot.myPrevious) : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+const T* IntrusiveList<T>::back() const noexcept
+{
+    return mySize > 0U ? static_cast<const T*>(myRoot.myPrevious) : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename IntrusiveList<T>::Iterator IntrusiveList<T>::begin() noexcept
+{
+    return Iterator{myRoot.myNext};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename IntrusiveList<T>::ConstIterator IntrusiveList<T>::begin() const noexcept
+{
+    return ConstIterator{myRoot.myNext};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename IntrusiveList<T>::Iterator IntrusiveList<T>::end() noexcept
+{
+    return Iterator{myRoot};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename IntrusiveList<T>::ConstIterator IntrusiveList<T>::end() const noexcept
+{
+    return ConstIterator{myRoot};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename IntrusiveList<T>::Iterator IntrusiveList<T>::rbegin() noexcept
+{
+    return Iterator{myRoot.myPrevious};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename IntrusiveList<T>::ConstIterator IntrusiveList<T>::rbegin() const noexcept
+{
+    return ConstIterator{myRoot.myPrevious};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename IntrusiveList<T>::Iterator IntrusiveList<T>::rend() noexcept
+{
+    return Iterator{myRoot};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+typename IntrusiveList<T>::ConstIterator IntrusiveList<T>::rend() const noexcept
+{
+    return ConstIterator{myRoot};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool IntrusiveList<T>::pushFront(T& element) noexcept
+{
+    return insert(begin(), element);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool IntrusiveList<T>::pushBack(T& element) noexcept
+{
+    return insert(end(), element);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool IntrusiveList<T>::insert(const Iterator& iterator, T& element) noexcept
+{
+    IntrusiveListHook& hook{element};
+    if (hook.isLinked()) { return false; }
+    link(hook, *static_cast<IntrusiveListHook*>(iterator.address()));
+    hook.myOwner = this;
+    mySize++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* IntrusiveList<T>::popFront() noexcept
+{
+    auto element{front()};
+    if (element != nullptr) { remove(*element); }
+    return element;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* IntrusiveList<T>::popBack() noexcept
+{
+    auto element{back()};
+    if (element != nullptr) { remove(*element); }
+    return element;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool IntrusiveList<T>::remove(T& element) noexcept
+{
+    IntrusiveListHook& hook{element};
+
+    // Unlinking an element of another list would corrupt the sizes of both lists.
+    if (hook.myOwner != this) { return false; }
+    unlink(hook);
+    mySize--;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void IntrusiveList<T>::clear() noexcept
+{
+    auto hook{myRoot.myNext};
+
+    while (hook != &myRoot)
+    {
+        auto next{hook->myNext};
+        hook->myPrevious = nullptr;
+        hook->myNext     = nullptr;
+        hook->myOwner    = nullptr;
+        hook             = next;
+    }
+    myRoot.myPrevious = &myRoot;
+    myRoot.myNext     = &myRoot;
+    mySize            = 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void IntrusiveList<T>::link(IntrusiveListHook& hook, IntrusiveListHook& next) noexcept
+{
+    auto previous{next.myPrevious};
+    hook.myPrevious  = previous;
+    hook.myNext      = &next;
+    previous->myNext = &hook;
+    next.myPrevious  = &hook;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void IntrusiveList<T>::unlink(IntrusiveListHook& hook) noexcept
+{
+    hook.myPrevious->myNext = hook.myNext;
+    hook.myNext->myPrevious = hook.myPrevious;
+    hook.myPrevious         = nullptr;
+    hook.myNext             = nullptr;
+    hook.myOwner            = nullptr;
+}
+} // namespace container
@@ -14,58 +14,76 @@ namespace container
  * 
  * @param[in] T The node type, i.e. the type of the stored data.
  */
-template <typename T>
-struct List<T>::Node 
+template <typename T, typename Allocator>
+struct List<T, Allocator>::Node 
 {
     Node* previous; // Pointer to previous node.
     Node* next;     // Pointer to next data.
     T data;         // Data the node holds.
 
-    static Node* create(const T& data) noexcept;
+    template <typename... Args>
+    static Node* create(Args&&... args) noexcept;
     static void destroy(Node* self) noexcept;
     static Node* get(Iterator& iterator) noexcept;
     static const Node* get(ConstIterator& iterator) noexcept;
 };
 
+/**
+ * @brief Accessor to the links and data of the nodes, used by the iterators.
+ * 
+ * @param[in] T The list type.
+ */
+template <typename T, typename Allocator>
+struct List<T, Allocator>::NodeAccess
+{
+    using Node  = typename List<T, Allocator>::Node; // The node type.
+    using Value = T;                                 // The type of the stored data.
+
+    static Node* next(const Node& node) noexcept { return node.next; }
+    static Node* previous(const Node& node) noexcept { return node.previous; }
+    static T& value(Node& node) noexcept { return node.data; }
+    static const T& value(const Node& node) noexcept { return node.data; }
+};
+
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::List() noexcept
+template <typename T, typename Allocator>
+List<T, Allocator>::List() noexcept
     : myFirst{nullptr}
     , myLast{nullptr}
-    , mySize{nullptr} {}
+    , mySize{} {}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::List(const size_t size, const T& startValue) noexcept
+template <typename T, typename Allocator>
+List<T, Allocator>::List(const size_t size, const T& startValue) noexcept
     : List() 
 { 
     resize(size, startValue); 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Values> 
-List<T>::List(const Values&&... values) noexcept
+List<T, Allocator>::List(const Values&&... values) noexcept
+    : List()
 { 
-    const T array[sizeof...(values)]{(values)...};
-    addValues(array);
+    (emplaceBack(values), ...);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::~List() noexcept { clear(); }
+template <typename T, typename Allocator>
+List<T, Allocator>::~List() noexcept { clear(); }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::List(const List<T>& other) noexcept
+template <typename T, typename Allocator>
+List<T, Allocator>::List(const List<T, Allocator>& other) noexcept
     : List()
 {
     copy(other);
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>::List(List<T>&& other) noexcept
+template <typename T, typename Allocator>
+List<T, Allocator>::List(List<T, Allocator>&& other) noexcept
     : myFirst{other.myFirst}
     , myLast{other.myLast}
     , mySize{other.mySize}
@@ -76,8 +94,8 @@ List<T>::List(List<T>&& other) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>& List<T>::operator=(const List<T>& other) noexcept
+template <typename T, typename Allocator>
+List<T, Allocator>& List<T, Allocator>::operator=(const List<T, Allocator>& other) noexcept
 {
     clear();
     copy(other);
@@ -85,8 +103,8 @@ List<T>& List<T>::operator=(const List<T>& other) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>& List<T>::operator=(List<T>&& other) noexcept
+template <typename T, typename Allocator>
+List<T, Allocator>& List<T, Allocator>::operator=(List<T, Allocator>&& other) noexcept
 {
     clear();
     myFirst = other.myFirst;
@@ -100,37 +118,45 @@ List<T>& List<T>::operator=(List<T>&& other) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-List<T>& List<T>::operator+=(const List<T>& other) noexcept 
+template <typename T, typename Allocator>
+List<T, Allocator>& List<T, Allocator>::operator+=(const List<T, Allocator>& other) noexcept 
 { 
     copy(other); 
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
+List<T, Allocator>& List<T, Allocator>::operator+=(List<T, Allocator>&& other) noexcept 
+{ 
+    splice(end(), other); 
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
 template <size_t ValueCount>
-List<T>& List<T>::operator+=(const T (&values)[ValueCount]) noexcept 
+List<T, Allocator>& List<T, Allocator>::operator+=(const T (&values)[ValueCount]) noexcept 
 { 
     addValues(values); 
     return *this;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-T& List<T>::operator[](Iterator& iterator) noexcept { return *iterator; }
+template <typename T, typename Allocator>
+T& List<T, Allocator>::operator[](Iterator& iterator) noexcept { return *iterator; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const T& List<T>::operator[] (ConstIterator& iterator) const noexcept { return *iterator; }
+template <typename T, typename Allocator>
+const T& List<T, Allocator>::operator[] (ConstIterator& iterator) const noexcept { return *iterator; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-size_t List<T>::size() const noexcept { return mySize; }
+template <typename T, typename Allocator>
+size_t List<T, Allocator>::size() const noexcept { return mySize; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::clear() noexcept
+template <typename T, typename Allocator>
+void List<T, Allocator>::clear() noexcept
 {
     removeAllNodes();
     myFirst = nullptr;
@@ -139,56 +165,56 @@ void List<T>::clear() noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::empty() const noexcept { return mySize == 0U; }
+template <typename T, typename Allocator>
+bool List<T, Allocator>::empty() const noexcept { return mySize == 0U; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Iterator List<T>::begin() noexcept
+template <typename T, typename Allocator>
+typename List<T, Allocator>::Iterator List<T, Allocator>::begin() noexcept
 { 
     return mySize > 0U ? Iterator{myFirst} : Iterator{nullptr};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::ConstIterator List<T>::begin() const noexcept
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ConstIterator List<T, Allocator>::begin() const noexcept
 { 
     return mySize > 0U ? ConstIterator{myFirst} : ConstIterator{nullptr};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Iterator List<T>::end() noexcept { return Iterator{nullptr}; }
+template <typename T, typename Allocator>
+typename List<T, Allocator>::Iterator List<T, Allocator>::end() noexcept { return Iterator{nullptr}; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::ConstIterator List<T>::end() const noexcept { return ConstIterator{nullptr}; }
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ConstIterator List<T, Allocator>::end() const noexcept { return ConstIterator{nullptr}; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Iterator List<T>::rbegin() noexcept
+template <typename T, typename Allocator>
+typename List<T, Allocator>::Iterator List<T, Allocator>::rbegin() noexcept
 { 
     return mySize > 0U ? Iterator{myLast} : Iterator{nullptr};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::ConstIterator List<T>::rbegin() const noexcept
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ConstIterator List<T, Allocator>::rbegin() const noexcept
 { 
     return mySize > 0U ? ConstIterator{myLast} : ConstIterator{nullptr};
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Iterator List<T>::rend() noexcept { return Iterator{nullptr}; }
+template <typename T, typename Allocator>
+typename List<T, Allocator>::Iterator List<T, Allocator>::rend() noexcept { return Iterator{nullptr}; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::ConstIterator List<T>::rend() const noexcept { return ConstIterator{nullptr}; }
+template <typename T, typename Allocator>
+typename List<T, Allocator>::ConstIterator List<T, Allocator>::rend() const noexcept { return ConstIterator{nullptr}; }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::resize(const size_t newSize, const T& startValue) noexcept
+template <typename T, typename Allocator>
+bool List<T, Allocator>::resize(const size_t newSize, const T& startValue) noexcept
 {
     while (mySize < newSize) 
     {
@@ -199,10 +225,19 @@ bool List<T>::resize(const size_t newSize, const T& startValue) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::pushFront(const T& value) noexcept
+template <typename T, typename Allocator>
+bool List<T, Allocator>::pushFront(const T& value) noexcept { return emplaceFront(value); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+bool List<T, Allocator>::pushFront(T&& value) noexcept { return emplaceFront(utils::move(value)); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename... Args>
+bool List<T, Allocator>::emplaceFront(Args&&... args) noexcept
 {
-    auto node1{Node::create(value)};
+    auto node1{Node::create(utils::forward<Args>(args)...)};
     if (node1 == nullptr) { return false; }
 
     if (mySize++ == 0U) 
@@ -221,10 +256,19 @@ bool List<T>::pushFront(const T& value) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::pushBack(const T& value) noexcept
+template <typename T, typename Allocator>
+bool List<T, Allocator>::pushBack(const T& value) noexcept { return emplaceBack(value); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+bool List<T, Allocator>::pushBack(T&& value) noexcept { return emplaceBack(utils::move(value)); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename... Args>
+bool List<T, Allocator>::emplaceBack(Args&&... args) noexcept
 {
-    auto node2{Node::create(value)};
+    auto node2{Node::create(utils::forward<Args>(args)...)};
     if (node2 == nullptr) { return false; }  
 
     if (mySize++ == 0U) 
@@ -243,26 +287,28 @@ bool List<T>::pushBack(const T& value) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::insert(Iterator& iterator, const T& value) noexcept
+template <typename T, typename Allocator>
+bool List<T, Allocator>::insert(Iterator& iterator, const T& value) noexcept
 {
-    if (iterator == nullptr) {  return false; }
+    auto node3{Node::get(iterator)};
+    if (node3 == nullptr) { return false; }
     auto node2{Node::create(value)};
-    if (node2 == nullptr) return false;   
-    auto node1{Node::get(iterator)->previous};
-    auto node3{node1->next};
+    if (node2 == nullptr) { return false; }
+    auto node1{node3->previous};
 
-    node1->next     = node2;
+    // Link the new node in front of node3, nullptr node1 meaning the front of the list.
     node2->previous = node1;
     node2->next     = node3;
+    if (node1 != nullptr) { node1->next = node2; }
+    else { myFirst = node2; }
     node3->previous = node2;
     mySize++;
     return true;      
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::popFront() noexcept
+template <typename T, typename Allocator>
+void List<T, Allocator>::popFront() noexcept
 {
     if (mySize <= 1U) { clear(); }
     else
@@ -277,8 +323,8 @@ void List<T>::popFront() noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::popBack() noexcept
+template <typename T, typename Allocator>
+void List<T, Allocator>::popBack() noexcept
 {
     if (mySize <= 1U) { clear(); }
     else 
@@ -293,38 +339,134 @@ void List<T>::popBack() noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::remove(Iterator& iterator) noexcept
+template <typename T, typename Allocator>
+bool List<T, Allocator>::remove(Iterator& iterator) noexcept
 {
-    if (iterator == nullptr) { return false; } 
-    else 
+    auto node2{Node::get(iterator)};
+    if (node2 == nullptr) { return false; }
+    auto node1{node2->previous};
+    auto node3{node2->next};
+
+    // Unlink the node, nullptr meaning the front or back of the list.
+    if (node1 != nullptr) { node1->next = node3; }
+    else { myFirst = node3; }
+    if (node3 != nullptr) { node3->previous = node1; }
+    else { myLast = node1; }
+    Node::destroy(node2);
+    mySize--;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+void List<T, Allocator>::splice(const Iterator& position, List<T, Allocator>& other) noexcept
+{
+    if ((&other == this) || (other.mySize == 0U)) { return; }
+    Iterator iterator{position};
+    auto node3{Node::get(iterator)};
+    auto node1{node3 != nullptr ? node3->previous : myLast};
+
+    // Link the other list's chain between node1 and node3, nullptr meaning front or back.
+    other.myFirst->previous = node1;
+    other.myLast->next      = node3;
+    if (node1 != nullptr) { node1->next = other.myFirst; }
+    else { myFirst = other.myFirst; }
+    if (node3 != nullptr) { node3->previous = other.myLast; }
+    else { myLast = other.myLast; }
+
+    mySize += other.mySize;
+    other.release();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+bool List<T, Allocator>::splice(const Iterator& position, List<T, Allocator>& other, 
+                                const Iterator& element) noexcept
+{
+    Iterator iterator{position};
+    Iterator source{element};
+    auto node2{Node::get(source)};
+    auto node3{Node::get(iterator)};
+    if (node2 == nullptr) { return false; }
+    if ((node2 == node3) || (node2->next == node3 && &other == this)) { return true; }
+
+    // Unlink the node from the other list.
+    if (node2->previous != nullptr) { node2->previous->next = node2->next; }
+    else { other.myFirst = node2->next; }
+    if (node2->next != nullptr) { node2->next->previous = node2->previous; }
+    else { other.myLast = node2->previous; }
+    other.mySize--;
+
+    // Link the node in front of node3, nullptr meaning the back of this list.
+    auto node1{node3 != nullptr ? node3->previous : myLast};
+    node2->previous = node1;
+    node2->next     = node3;
+    if (node1 != nullptr) { node1->next = node2; }
+    else { myFirst = node2; }
+    if (node3 != nullptr) { node3->previous = node2; }
+    else { myLast = node2; }
+    mySize++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename Compare>
+void List<T, Allocator>::merge(List<T, Allocator>& other, const Compare& compare) noexcept
+{
+    if ((&other == this) || (other.mySize == 0U)) { return; }
+    Node* last{nullptr};
+    myFirst = mergeChains(myFirst, other.myFirst, last, compare);
+    mySize += other.mySize;
+    other.release();
+    relinkPrevious();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename Compare>
+void List<T, Allocator>::sort(const Compare& compare) noexcept
+{
+    // Merge runs of width 1, 2, 4... via the next pointers only, then restore the previous 
+    // pointers once, since a singly linked merge touches half as many links.
+    for (size_t width{1U}; width < mySize; width *= 2U)
     {
-        auto node2{iterator.get()};
-        auto node1{node2->previous};
-        auto node3{node2->next};
-        node1->next = node3;
-        node3->previous = node1;
-        Node::destroy(node2);
-        mySize--;
-        return true;
+        Node* remaining{myFirst};
+        Node* first{nullptr};
+        Node* last{nullptr};
+
+        while (remaining != nullptr)
+        {
+            auto left{remaining};
+            auto right{split(left, width)};
+            remaining = split(right, width);
+
+            Node* mergedLast{nullptr};
+            auto merged{mergeChains(left, right, mergedLast, compare)};
+            if (last != nullptr) { last->next = merged; }
+            else { first = merged; }
+            last = mergedLast;
+        }
+        myFirst = first;
     }
+    if (mySize > 1U) { relinkPrevious(); }
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-bool List<T>::copy(const List<T>& other) noexcept
+template <typename T, typename Allocator>
+bool List<T, Allocator>::copy(const List<T, Allocator>& other) noexcept
 {
-    for (size_t i{}; i < other.size(); ++i) 
+    for (const auto& value : other) 
     {
-        if (!pushBack(other[i])) { return false; }
+        if (!pushBack(value)) { return false; }
     }
     return true;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template <size_t ValueCount>
-void List<T>::assign(const T (&values)[ValueCount], const size_t offset) noexcept
+void List<T, Allocator>::assign(const T (&values)[ValueCount], const size_t offset) noexcept
 {
     for (size_t i{}; i < ValueCount && offset + i < mySize; ++i)
     {
@@ -333,9 +475,9 @@ void List<T>::assign(const T (&values)[ValueCount], const size_t offset) noexcep
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
+template <typename T, typename Allocator>
 template <size_t ValueCount>
-bool List<T>::addValues(const T (&values)[ValueCount]) noexcept
+bool List<T, Allocator>::addValues(const T (&values)[ValueCount]) noexcept
 {
     if (ValueCount == 0U) { return false; }
     for (size_t i{}; i < ValueCount; ++i)
@@ -346,8 +488,8 @@ bool List<T>::addValues(const T (&values)[ValueCount]) noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::removeAllNodes() noexcept
+template <typename T, typename Allocator>
+void List<T, Allocator>::removeAllNodes() noexcept
 {
     for (auto i{begin()}; i != end();) 
     {
@@ -358,32 +500,105 @@ void List<T>::removeAllNodes() noexcept
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Node* List<T>::Node::create(const T& data) noexcept
+template <typename T, typename Allocator>
+void List<T, Allocator>::release() noexcept
+{
+    myFirst = nullptr;
+    myLast  = nullptr;
+    mySize  = 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+void List<T, Allocator>::relinkPrevious() noexcept
+{
+    Node* previous{nullptr};
+    for (auto node{myFirst}; node != nullptr; node = node->next)
+    {
+        node->previous = previous;
+        previous       = node;
+    }
+    myLast = previous;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+typename List<T, Allocator>::Node* List<T, Allocator>::split(Node* first, 
+                                                             const size_t count) noexcept
+{
+    // Cut the chain after given number of nodes and return the rest of it.
+    for (size_t i{1U}; (first != nullptr) && (i < count); ++i) { first = first->next; }
+    if (first == nullptr) { return nullptr; }
+    auto rest{first->next};
+    first->next = nullptr;
+    return rest;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename Compare>
+typename List<T, Allocator>::Node* List<T, Allocator>::mergeChains(Node* first1, Node* first2, 
+                                                                   Node*& last, 
+                                                                   const Compare& compare) noexcept
+{
+    // Merge two nullptr-terminated chains via their next pointers, taking from the first 
+    // chain on ties to keep the merge stable.
+    Node* first{nullptr};
+    Node** link{&first};
+    last = nullptr;
+
+    while ((first1 != nullptr) && (first2 != nullptr))
+    {
+        if (compare(first2->data, first1->data))
+        {
+            last   = first2;
+            first2 = first2->next;
+        }
+        else
+        {
+            last   = first1;
+            first1 = first1->next;
+        }
+        *link = last;
+        link  = &last->next;
+    }
+    *link = first1 != nullptr ? first1 : first2;
+    for (; *link != nullptr; link = &(*link)->next) { last = *link; }
+    return first;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Allocator>
+template <typename... Args>
+typename List<T, Allocator>::Node* List<T, Allocator>::Node::create(Args&&... args) noexcept
 {
-    auto self{utils::newMemory<Node>()};
+    auto self{Allocator::template allocate<Node>()};
     if (self == nullptr) { return nullptr; }
-    self->data     = data;
+    utils::construct(&self->data, utils::forward<Args>(args)...);
     self->previous = nullptr;
     self->next     = nullptr;
     return self;
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-void List<T>::Node::destroy(Node* self) noexcept { utils::deleteMemory(self); }
+template <typename T, typename Allocator>
+void List<T, Allocator>::Node::destroy(Node* self) noexcept 
+{ 
+    utils::destroy(&self->data);
+    Allocator::deallocate(self); 
+}
 
 // -----------------------------------------------------------------------------
-template <typename T>
-typename List<T>::Node* List<T>::Node::get(Iterator& iterator) noexcept
+template <typename T, typename Allocator>
+typename List<T, Allocator>::Node* List<T, Allocator>::Node::get(Iterator& iterator) noexcept
 { 
     return static_cast<Node*>(iterator.address()); 
 }
 
 // -----------------------------------------------------------------------------
-template <typename T>
-const typename List<T>::Node* List<T>::Node::get(ConstIterator& iterator) noexcept
+template <typename T, typename Allocator>
+const typename List<T, Allocator>::Node* List<T, Allocator>::Node::get(ConstIterator& iterator) noexcept
 {
-    return static_cast<Node*>(iterator.address());
+    return static_cast<const Node*>(iterator.address());
 }
 } // namespace container
@@ -0,0 +1,186 @@
+/**
+ * @brief Implementation details of container::PriorityQueue class.
+ *
+ * @note Don't include this header, use <priority_queue.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+PriorityQueue<T, Compare, Storage, Tracker>::PriorityQueue(const Compare& compare, 
+                                                           const Tracker& tracker) noexcept
+    : myData{}
+    , myCompare{compare}
+    , myTracker{tracker} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+const T& PriorityQueue<T, Compare, Storage, Tracker>::operator[](const size_t index) const noexcept
+{
+    return myData[index];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+const T* PriorityQueue<T, Compare, Storage, Tracker>::top() const noexcept
+{
+    return myData.size() > 0U ? &myData[0U] : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+size_t PriorityQueue<T, Compare, Storage, Tracker>::size() const noexcept { return myData.size(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+bool PriorityQueue<T, Compare, Storage, Tracker>::empty() const noexcept { return myData.size() == 0U; }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+bool PriorityQueue<T, Compare, Storage, Tracker>::push(const T& value) noexcept
+{
+    if (!myData.pushBack(value)) { return false; }
+    siftUp(myData.size() - 1U);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+bool PriorityQueue<T, Compare, Storage, Tracker>::push(T&& value) noexcept
+{
+    if (!myData.pushBack(utils::move(value))) { return false; }
+    siftUp(myData.size() - 1U);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+bool PriorityQueue<T, Compare, Storage, Tracker>::pop() noexcept
+{
+    return remove(0U);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+bool PriorityQueue<T, Compare, Storage, Tracker>::pop(T& value) noexcept
+{
+    if (myData.size() == 0U) { return false; }
+    myTracker(myData[0U], Removed);
+    value = utils::move(myData[0U]);
+    return removeUntracked(0U);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+bool PriorityQueue<T, Compare, Storage, Tracker>::update(const size_t index, const T& value) noexcept
+{
+    if (index >= myData.size()) { return false; }
+    myData[index] = value;
+    restore(index);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+bool PriorityQueue<T, Compare, Storage, Tracker>::remove(const size_t index) noexcept
+{
+    if (index >= myData.size()) { return false; }
+    myTracker(myData[index], Removed);
+    return removeUntracked(index);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+bool PriorityQueue<T, Compare, Storage, Tracker>::removeUntracked(const size_t index) noexcept
+{
+    const auto lastIndex{myData.size() - 1U};
+
+    // Fill the gap with the last value, which may need to move either way.
+    if (index < lastIndex) { myData[index] = utils::move(myData[lastIndex]); }
+    myData.popBack();
+    if (index < lastIndex) { restore(index); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+template <typename Predicate>
+size_t PriorityQueue<T, Compare, Storage, Tracker>::findIf(const Predicate& predicate) const noexcept
+{
+    for (size_t i{}; i < myData.size(); ++i)
+    {
+        if (predicate(myData[i])) { return i; }
+    }
+    return myData.size();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+void PriorityQueue<T, Compare, Storage, Tracker>::clear() noexcept 
+{ 
+    for (size_t i{}; i < myData.size(); ++i) { myTracker(myData[i], Removed); }
+    myData.clear(); 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+size_t PriorityQueue<T, Compare, Storage, Tracker>::parent(const size_t index) noexcept
+{
+    return (index - 1U) / 2U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+void PriorityQueue<T, Compare, Storage, Tracker>::siftUp(size_t index) noexcept
+{
+    // Move the parents down until the hole is where the value belongs.
+    T value{utils::move(myData[index])};
+
+    while (index > 0U)
+    {
+        const auto parentIndex{parent(index)};
+        if (!myCompare(myData[parentIndex], value)) { break; }
+        place(index, utils::move(myData[parentIndex]));
+        index = parentIndex;
+    }
+    place(index, utils::move(value));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+void PriorityQueue<T, Compare, Storage, Tracker>::siftDown(size_t index) noexcept
+{
+    // Move the children with the highest priority up until the hole is where the value belongs.
+    const auto size{myData.size()};
+    T value{utils::move(myData[index])};
+
+    while (true)
+    {
+        auto child{2U * index + 1U};
+        if (child >= size) { break; }
+        if ((child + 1U < size) && myCompare(myData[child], myData[child + 1U])) { ++child; }
+        if (!myCompare(value, myData[child])) { break; }
+        place(index, utils::move(myData[child]));
+        index = child;
+    }
+    place(index, utils::move(value));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+void PriorityQueue<T, Compare, Storage, Tracker>::restore(const size_t index) noexcept
+{
+    if ((index > 0U) && myCompare(myData[parent(index)], myData[index])) { siftUp(index); }
+    else { siftDown(index); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare, typename Storage, typename Tracker>
+void PriorityQueue<T, Compare, Storage, Tracker>::place(const size_t index, T&& value) noexcept
+{
+    myData[index] = utils::move(value);
+    myTracker(myData[index], index);
+}
+} // namespace container
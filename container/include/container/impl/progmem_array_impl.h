@@ -0,0 +1,75 @@
+/**
+ * @brief Implementation details of container::ProgmemArray class.
+ *
+ * @note Don't include this header, use <progmem_array.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+constexpr ProgmemArray<T, Size>::ProgmemArray(const T (&values)[Size]) noexcept
+    : myData{}
+{
+    for (size_t i{}; i < Size; ++i) { myData[i] = values[i]; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+T ProgmemArray<T, Size>::operator[](const size_t index) const noexcept
+{
+    return read(myData + index);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+size_t ProgmemArray<T, Size>::copy(T* destination, const size_t offset,
+                                   const size_t count) const noexcept
+{
+    if (offset >= Size) { return 0U; }
+    const auto copyCount{count < Size - offset ? count : Size - offset};
+    memcpy_P(destination, myData + offset, copyCount * sizeof(T));
+    return copyCount;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+constexpr typename ProgmemArray<T, Size>::ConstIterator ProgmemArray<T, Size>::begin() const noexcept
+{
+    return ConstIterator{myData};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+constexpr typename ProgmemArray<T, Size>::ConstIterator ProgmemArray<T, Size>::end() const noexcept
+{
+    return ConstIterator{myData + Size};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Size>
+T ProgmemArray<T, Size>::read(const T* address) noexcept
+{
+    T value;
+
+    // Read small values via single load instructions, larger values via a block copy.
+    if constexpr (sizeof(T) == 1U)
+    {
+        const uint8_t byte{pgm_read_byte(address)};
+        memcpy(&value, &byte, sizeof(T));
+    }
+    else if constexpr (sizeof(T) == 2U)
+    {
+        const uint16_t word{pgm_read_word(address)};
+        memcpy(&value, &word, sizeof(T));
+    }
+    else if constexpr (sizeof(T) == 4U)
+    {
+        const uint32_t dword{pgm_read_dword(address)};
+        memcpy(&value, &dword, sizeof(T));
+    }
+    else { memcpy_P(&value, address, sizeof(T)); }
+    return value;
+}
+} // namespace container
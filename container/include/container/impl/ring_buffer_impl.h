@@ -0,0 +1,97 @@
+/**
+ * @brief Implementation details of container::RingBuffer class.
+ *
+ * @note Don't include this header, use <ring_buffer.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+RingBuffer<T, N>::RingBuffer() noexcept
+    : myData{}
+    , myHead{}
+    , myTail{} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool RingBuffer<T, N>::push(const T& value) noexcept
+{
+    return push(&value, 1U) == 1U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+size_t RingBuffer<T, N>::push(const T* values, const size_t count) noexcept
+{
+    // Read each index once, the tail may be updated by the consumer at any time.
+    const uint8_t head{myHead};
+    const uint8_t free{static_cast<uint8_t>(N - static_cast<uint8_t>(head - myTail))};
+    const auto pushCount{count < free ? count : free};
+
+    for (size_t i{}; i < pushCount; ++i)
+    {
+        myData[static_cast<uint8_t>(head + i) & Mask] = values[i];
+    }
+
+    // Publish the values before the new head.
+    barrier();
+    myHead = static_cast<uint8_t>(head + pushCount);
+    return pushCount;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool RingBuffer<T, N>::pop(T& value) noexcept
+{
+    return pop(&value, 1U) == 1U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+size_t RingBuffer<T, N>::pop(T* values, const size_t count) noexcept
+{
+    // Read each index once, the head may be updated by the producer at any time.
+    const uint8_t tail{myTail};
+    const uint8_t used{static_cast<uint8_t>(myHead - tail)};
+    const auto popCount{count < used ? count : used};
+
+    // Read the values before releasing the slots to the producer.
+    barrier();
+    for (size_t i{}; i < popCount; ++i)
+    {
+        values[i] = myData[static_cast<uint8_t>(tail + i) & Mask];
+    }
+    barrier();
+    myTail = static_cast<uint8_t>(tail + popCount);
+    return popCount;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void RingBuffer<T, N>::clear() noexcept { myTail = myHead; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+size_t RingBuffer<T, N>::size() const noexcept
+{
+    return static_cast<uint8_t>(myHead - myTail);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool RingBuffer<T, N>::empty() const noexcept { return myHead == myTail; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool RingBuffer<T, N>::full() const noexcept { return size() == N; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void RingBuffer<T, N>::barrier() noexcept
+{
+    // Prevent the compiler from reordering memory accesses across this point.
+    asm volatile("" ::: "memory");
+}
+} // namespace container
@@ -0,0 +1,400 @@
+/**
+ * @brief Implementation details of container::SmallVector class.
+ *
+ * @note Don't include this header, use <small_vector.h> instead!
+ */
+#pragma once
+
+#include <string.h>
+
+#include "utils/utils.h"
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector() noexcept
+    : myData{inlineData()}
+    , mySize{}
+    , myCapacity{N} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(const size_t size) noexcept
+    : SmallVector()
+{
+    resize(size);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+template <typename... Values>
+SmallVector<T, N>::SmallVector(const Values&&... values) noexcept
+    : SmallVector()
+{
+    if (!reserve(sizeof...(values))) { return; }
+    (utils::construct(myData + mySize++, values), ...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(const SmallVector& other) noexcept
+    : SmallVector()
+{
+    addValues(other.myData, other.mySize);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::SmallVector(SmallVector&& other) noexcept
+    : SmallVector()
+{
+    takeOver(other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>::~SmallVector() noexcept
+{
+    clear();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>& SmallVector<T, N>::operator=(const SmallVector& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        addValues(other.myData, other.mySize);
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>& SmallVector<T, N>::operator=(SmallVector&& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        takeOver(other);
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+SmallVector<T, N>& SmallVector<T, N>::operator+=(const SmallVector& other) noexcept
+{
+    addValues(other.myData, other.mySize);
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+template <size_t ValueCount>
+SmallVector<T, N>& SmallVector<T, N>::operator+=(const T (&values)[ValueCount]) noexcept
+{
+    addValues(values, ValueCount);
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T& SmallVector<T, N>::operator[](const size_t index) noexcept { return myData[index]; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+const T& SmallVector<T, N>::operator[](const size_t index) const noexcept
+{
+    return myData[index];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T* SmallVector<T, N>::data() noexcept { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+const T* SmallVector<T, N>::data() const noexcept { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+size_t SmallVector<T, N>::size() const noexcept { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+size_t SmallVector<T, N>::capacity() const noexcept { return myCapacity; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::empty() const noexcept { return mySize == 0U; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::isInline() const noexcept
+{
+    return myData == reinterpret_cast<const T*>(myStorage);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::Iterator SmallVector<T, N>::begin() noexcept
+{
+    return Iterator{myData};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::begin() const noexcept
+{
+    return ConstIterator{myData};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::Iterator SmallVector<T, N>::end() noexcept
+{
+    return Iterator{myData + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::end() const noexcept
+{
+    return ConstIterator{myData + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::Iterator SmallVector<T, N>::rbegin() noexcept
+{
+    return mySize > 0U ? Iterator{myData + mySize - 1U} : Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::rbegin() const noexcept
+{
+    return mySize > 0U ? ConstIterator{myData + mySize - 1U} : ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::Iterator SmallVector<T, N>::rend() noexcept
+{
+    return mySize > 0U ? Iterator{myData - 1U} : Iterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename SmallVector<T, N>::ConstIterator SmallVector<T, N>::rend() const noexcept
+{
+    return mySize > 0U ? ConstIterator{myData - 1U} : ConstIterator{nullptr};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T* SmallVector<T, N>::last() noexcept { return mySize > 0U ? myData + mySize - 1U : nullptr; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+const T* SmallVector<T, N>::last() const noexcept
+{
+    return mySize > 0U ? myData + mySize - 1U : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void SmallVector<T, N>::clear() noexcept
+{
+    utils::destroy(myData, mySize);
+    if (!isInline()) { utils::deleteMemory<T>(myData); }
+    myData     = inlineData();
+    mySize     = 0U;
+    myCapacity = N;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::resize(const size_t newSize) noexcept
+{
+    if (newSize < mySize)
+    {
+        utils::destroy(myData + newSize, mySize - newSize);
+    }
+    else
+    {
+        if (!grow(newSize)) { return false; }
+
+        // Value initialization of trivial types sets all bits to zero.
+        if constexpr (type_traits::is_trivial<T>::value)
+        {
+            utils::fillValues(myData + mySize, T{}, newSize - mySize);
+        }
+        else
+        {
+            for (size_t i{mySize}; i < newSize; ++i) { utils::construct(myData + i); }
+        }
+    }
+    mySize = newSize;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::reserve(const size_t capacity) noexcept
+{
+    return capacity <= myCapacity ? true : reallocate(capacity);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::shrinkToFit() noexcept
+{
+    if (isInline() || (mySize == myCapacity)) { return true; }
+    return reallocate(mySize);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::pushBack(const T& value) noexcept { return emplaceBack(value); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::pushBack(T&& value) noexcept
+{
+    return emplaceBack(utils::move(value));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+template <typename... Args>
+bool SmallVector<T, N>::emplaceBack(Args&&... args) noexcept
+{
+    if (mySize < myCapacity)
+    {
+        utils::construct(myData + mySize, utils::forward<Args>(args)...);
+    }
+    else
+    {
+        // Construct the value first, since the arguments may refer to elements of this vector.
+        T value(utils::forward<Args>(args)...);
+        if (!grow(mySize + 1U)) { return false; }
+        utils::construct(myData + mySize, utils::move(value));
+    }
+    ++mySize;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::popBack() noexcept
+{
+    if (mySize > 0U) { utils::destroy(myData + --mySize); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T* SmallVector<T, N>::inlineData() noexcept { return reinterpret_cast<T*>(myStorage); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::addValues(const T* values, const size_t count) noexcept
+{
+    // Compute the source offset first, since the values may be stored in this vector.
+    const auto isOwnData{(values >= myData) && (values < myData + mySize)};
+    const auto offset{isOwnData ? static_cast<size_t>(values - myData) : 0U};
+    if (!grow(mySize + count)) { return false; }
+    if (isOwnData) { values = myData + offset; }
+
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        if (count > 0U) { memcpy(myData + mySize, values, count * sizeof(T)); }
+    }
+    else
+    {
+        for (size_t i{}; i < count; ++i) { utils::construct(myData + mySize + i, values[i]); }
+    }
+    mySize += count;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::grow(const size_t newSize) noexcept
+{
+    // Grow geometrically to make repeated appends amortized O(1).
+    if (newSize <= myCapacity) { return true; }
+    const auto doubleCapacity{2U * myCapacity};
+    return reallocate(newSize > doubleCapacity ? newSize : doubleCapacity);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool SmallVector<T, N>::reallocate(const size_t newCapacity) noexcept
+{
+    // Use the inline storage whenever the elements fit.
+    const auto toInline{newCapacity <= N};
+    if (toInline && isInline()) { return true; }
+
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        if (!toInline && !isInline())
+        {
+            auto copy{utils::reallocMemory<T>(myData, newCapacity)};
+            if (copy == nullptr) { return false; }
+            myData     = copy;
+            myCapacity = newCapacity;
+            return true;
+        }
+    }
+    auto copy{toInline ? inlineData() : utils::newMemory<T>(newCapacity)};
+    if (copy == nullptr) { return false; }
+
+    // Move the elements to the new memory, then destroy the old elements.
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        if (mySize > 0U) { memcpy(copy, myData, mySize * sizeof(T)); }
+    }
+    else
+    {
+        for (size_t i{}; i < mySize; ++i)
+        {
+            utils::construct(copy + i, utils::move(myData[i]));
+        }
+        utils::destroy(myData, mySize);
+    }
+    if (!isInline()) { utils::deleteMemory<T>(myData); }
+    myData     = copy;
+    myCapacity = toInline ? N : newCapacity;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void SmallVector<T, N>::takeOver(SmallVector& other) noexcept
+{
+    // Take over heap memory, move inline elements one by one. This vector must be empty.
+    if (other.isInline())
+    {
+        for (size_t i{}; i < other.mySize; ++i)
+        {
+            utils::construct(myData + i, utils::move(other.myData[i]));
+        }
+        mySize = other.mySize;
+        other.clear();
+    }
+    else
+    {
+        myData           = other.myData;
+        mySize           = other.mySize;
+        myCapacity       = other.myCapacity;
+        other.myData     = other.inlineData();
+        other.mySize     = 0U;
+        other.myCapacity = N;
+    }
+}
+} // namespace container
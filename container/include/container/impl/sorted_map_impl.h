@@ -0,0 +1,139 @@
+/**
+ * @brief Implementation details of container::SortedMap class.
+ *
+ * @note Don't include this header, use <sorted_map.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+SortedMap<K, V, Compare>::SortedMap(const Compare& compare) noexcept
+    : myData{}
+    , myCompare{compare} {}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+const typename SortedMap<K, V, Compare>::Entry& 
+    SortedMap<K, V, Compare>::operator[](const size_t index) const noexcept
+{
+    return myData[index];
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+size_t SortedMap<K, V, Compare>::size() const noexcept { return myData.size(); }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+bool SortedMap<K, V, Compare>::empty() const noexcept { return myData.empty(); }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+typename SortedMap<K, V, Compare>::ConstIterator SortedMap<K, V, Compare>::begin() const noexcept
+{
+    return myData.begin();
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+typename SortedMap<K, V, Compare>::ConstIterator SortedMap<K, V, Compare>::end() const noexcept
+{
+    return myData.end();
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+bool SortedMap<K, V, Compare>::insert(const K& key, const V& value) noexcept
+{
+    // Append keys following the last key directly, which makes adding sorted keys O(1) each.
+    if (myData.empty() || myCompare(myData[myData.size() - 1U].first, key))
+    {
+        return myData.pushBack(Entry{key, value});
+    }
+
+    const auto index{lowerBound(key)};
+    if (!myCompare(key, myData[index].first)) 
+    { 
+        myData[index].second = value;
+        return true;
+    }
+    return myData.insert(index, Entry{key, value});
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+bool SortedMap<K, V, Compare>::remove(const K& key) noexcept
+{
+    const auto index{findIndex(key)};
+    return (index < myData.size()) && myData.erase(index);
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+void SortedMap<K, V, Compare>::clear() noexcept { myData.clear(); }
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+bool SortedMap<K, V, Compare>::reserve(const size_t capacity) noexcept 
+{ 
+    return myData.reserve(capacity); 
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+V* SortedMap<K, V, Compare>::find(const K& key) noexcept
+{
+    const auto index{findIndex(key)};
+    return index < myData.size() ? &myData[index].second : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+const V* SortedMap<K, V, Compare>::find(const K& key) const noexcept
+{
+    const auto index{findIndex(key)};
+    return index < myData.size() ? &myData[index].second : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+bool SortedMap<K, V, Compare>::contains(const K& key) const noexcept
+{
+    return findIndex(key) < myData.size();
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+size_t SortedMap<K, V, Compare>::lowerBound(const K& key) const noexcept
+{
+    const auto entryPrecedesKey{[this](const Entry& entry, const K& key) 
+    { 
+        return myCompare(entry.first, key); 
+    }};
+    return distance(myData.begin(), container::lowerBound(myData.begin(), myData.end(), 
+                                                          key, entryPrecedesKey));
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+size_t SortedMap<K, V, Compare>::upperBound(const K& key) const noexcept
+{
+    const auto keyPrecedesEntry{[this](const K& key, const Entry& entry) 
+    { 
+        return myCompare(key, entry.first); 
+    }};
+    return distance(myData.begin(), container::upperBound(myData.begin(), myData.end(), 
+                                                          key, keyPrecedesEntry));
+}
+
+// -----------------------------------------------------------------------------
+template <typename K, typename V, typename Compare>
+size_t SortedMap<K, V, Compare>::findIndex(const K& key) const noexcept
+{
+    const auto index{lowerBound(key)};
+    return (index < myData.size()) && !myCompare(key, myData[index].first) ? index 
+                                                                           : myData.size();
+}
+} // namespace container
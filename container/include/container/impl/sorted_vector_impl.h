@@ -0,0 +1,132 @@
+/**
+ * @brief Implementation details of container::SortedVector class.
+ *
+ * @note Don't include this header, use <sorted_vector.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+SortedVector<T, Compare>::SortedVector(const Compare& compare) noexcept
+    : myData{}
+    , myCompare{compare} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+const T& SortedVector<T, Compare>::operator[](const size_t index) const noexcept 
+{ 
+    return myData[index]; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+const T* SortedVector<T, Compare>::data() const noexcept { return myData.data(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+size_t SortedVector<T, Compare>::size() const noexcept { return myData.size(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+bool SortedVector<T, Compare>::empty() const noexcept { return myData.empty(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+typename SortedVector<T, Compare>::ConstIterator SortedVector<T, Compare>::begin() const noexcept
+{
+    return myData.begin();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+typename SortedVector<T, Compare>::ConstIterator SortedVector<T, Compare>::end() const noexcept
+{
+    return myData.end();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+bool SortedVector<T, Compare>::assign(Span<const T> values) noexcept
+{
+    myData.clear();
+    if (!myData.reserve(values.size())) { return false; }
+
+    for (const auto& value : values)
+    {
+        if (!insert(value)) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+bool SortedVector<T, Compare>::insert(const T& value) noexcept
+{
+    // Check the back first, which makes adding sorted values O(1) each.
+    if (myData.empty() || !myCompare(value, myData[myData.size() - 1U]))
+    {
+        return myData.pushBack(value);
+    }
+    return myData.insert(upperBound(value), value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+bool SortedVector<T, Compare>::remove(const T& value) noexcept
+{
+    const auto index{lowerBound(value)};
+    return (index < myData.size()) && isEqual(myData[index], value) && myData.erase(index);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+void SortedVector<T, Compare>::clear() noexcept { myData.clear(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+bool SortedVector<T, Compare>::reserve(const size_t capacity) noexcept 
+{ 
+    return myData.reserve(capacity); 
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+const T* SortedVector<T, Compare>::find(const T& value) const noexcept
+{
+    const auto index{lowerBound(value)};
+    return (index < myData.size()) && isEqual(myData[index], value) ? &myData[index] : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+bool SortedVector<T, Compare>::contains(const T& value) const noexcept
+{
+    return find(value) != nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+size_t SortedVector<T, Compare>::lowerBound(const T& value) const noexcept
+{
+    return distance(myData.begin(), container::lowerBound(myData.begin(), myData.end(), 
+                                                          value, myCompare));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+size_t SortedVector<T, Compare>::upperBound(const T& value) const noexcept
+{
+    return distance(myData.begin(), container::upperBound(myData.begin(), myData.end(), 
+                                                          value, myCompare));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename Compare>
+bool SortedVector<T, Compare>::isEqual(const T& x, const T& y) const noexcept
+{
+    // Values are equivalent if neither precedes the other.
+    return !myCompare(x, y) && !myCompare(y, x);
+}
+} // namespace container
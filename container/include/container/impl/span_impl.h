@@ -0,0 +1,170 @@
+/**
+ * @brief Implementation details of container::Span class.
+ *
+ * @note Don't include this header, use <span.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr Span<T>::Span() noexcept
+    : myData{nullptr}
+    , mySize{} {}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr Span<T>::Span(T* data, const size_t size) noexcept
+    : myData{data}
+    , mySize{size} {}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <size_t Size>
+constexpr Span<T>::Span(T (&values)[Size]) noexcept
+    : myData{values}
+    , mySize{Size} {}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <size_t Size>
+constexpr Span<T>::Span(Array<ValueType, Size>& array) noexcept
+    : myData{array.data()}
+    , mySize{Size} {}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <size_t Size>
+constexpr Span<T>::Span(const Array<ValueType, Size>& array) noexcept
+    : myData{nullptr}
+    , mySize{}
+{
+    // Only read-only spans may view const containers, skip the assignments otherwise to
+    // report the static assertion alone.
+    static_assert(type_traits::is_const<T>::value,
+                  "Spans of const containers must be read-only, use Span<const T>!");
+    if constexpr (type_traits::is_const<T>::value)
+    {
+        myData = array.data();
+        mySize = Size;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+Span<T>::Span(Vector<ValueType>& vector) noexcept
+    : Span{vector.data(), vector.size()} {}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+Span<T>::Span(const Vector<ValueType>& vector) noexcept
+    : myData{nullptr}
+    , mySize{}
+{
+    static_assert(type_traits::is_const<T>::value,
+                  "Spans of const containers must be read-only, use Span<const T>!");
+    if constexpr (type_traits::is_const<T>::value)
+    {
+        myData = vector.data();
+        mySize = vector.size();
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <size_t N>
+Span<T>::Span(StaticVector<ValueType, N>& vector) noexcept
+    : Span{vector.data(), vector.size()} {}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <size_t N>
+Span<T>::Span(const StaticVector<ValueType, N>& vector) noexcept
+    : myData{nullptr}
+    , mySize{}
+{
+    static_assert(type_traits::is_const<T>::value,
+                  "Spans of const containers must be read-only, use Span<const T>!");
+    if constexpr (type_traits::is_const<T>::value)
+    {
+        myData = vector.data();
+        mySize = vector.size();
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <size_t N>
+Span<T>::Span(SmallVector<ValueType, N>& vector) noexcept
+    : Span{vector.data(), vector.size()} {}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <size_t N>
+Span<T>::Span(const SmallVector<ValueType, N>& vector) noexcept
+    : myData{nullptr}
+    , mySize{}
+{
+    static_assert(type_traits::is_const<T>::value,
+                  "Spans of const containers must be read-only, use Span<const T>!");
+    if constexpr (type_traits::is_const<T>::value)
+    {
+        myData = vector.data();
+        mySize = vector.size();
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr Span<T>::Span(const Span<ValueType>& other) noexcept
+    : myData{other.data()}
+    , mySize{other.size()} {}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr T& Span<T>::operator[](const size_t index) const noexcept { return myData[index]; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr T* Span<T>::data() const noexcept { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr size_t Span<T>::size() const noexcept { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr bool Span<T>::empty() const noexcept { return mySize == 0U; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr typename Span<T>::Iterator Span<T>::begin() const noexcept { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr typename Span<T>::Iterator Span<T>::end() const noexcept { return myData + mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr Span<T> Span<T>::subspan(const size_t offset, const size_t count) const noexcept
+{
+    if (offset >= mySize) { return Span{}; }
+    const auto remaining{mySize - offset};
+    return Span{myData + offset, count < remaining ? count : remaining};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr Span<T> Span<T>::first(const size_t count) const noexcept
+{
+    return subspan(0U, count);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr Span<T> Span<T>::last(const size_t count) const noexcept
+{
+    return count < mySize ? subspan(mySize - count) : *this;
+}
+} // namespace container
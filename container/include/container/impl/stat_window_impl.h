@@ -0,0 +1,166 @@
+/**
+ * @brief Implementation details of container::StatWindow class.
+ *
+ * @note Don't include this header, use <stat_window.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+StatWindow<T, N>::StatWindow() noexcept
+    : myData{}
+    , myHead{}
+    , mySize{}
+    , myOffset{}
+    , mySum{}
+    , mySumOfSquares{}
+    , myMinDeque{}
+    , myMaxDeque{} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void StatWindow<T, N>::push(const T& sample) noexcept
+{
+    // Discard the oldest sample, which is stored in the slot to overwrite.
+    if (mySize == N)
+    {
+        const auto oldest{static_cast<double>(myData[myHead]) - myOffset};
+        mySum          -= oldest;
+        mySumOfSquares -= oldest * oldest;
+        evict(myMinDeque, myHead);
+        evict(myMaxDeque, myHead);
+    }
+    else { ++mySize; }
+
+    const auto value{static_cast<double>(sample) - myOffset};
+    myData[myHead]  = sample;
+    mySum          += value;
+    mySumOfSquares += value * value;
+    insert(myMinDeque, myHead, true);
+    insert(myMaxDeque, myHead, false);
+    myHead = wrap(myHead + 1U);
+
+    // Discard the accumulated rounding errors once per lap of the ring.
+    if (myHead == 0U) { recomputeSums(); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void StatWindow<T, N>::clear() noexcept
+{
+    myHead           = 0U;
+    mySize           = 0U;
+    myOffset         = 0.0;
+    mySum            = 0.0;
+    mySumOfSquares   = 0.0;
+    myMinDeque.count = 0U;
+    myMaxDeque.count = 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+size_t StatWindow<T, N>::size() const noexcept { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool StatWindow<T, N>::empty() const noexcept { return mySize == 0U; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool StatWindow<T, N>::full() const noexcept { return mySize == N; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T StatWindow<T, N>::latest() const noexcept
+{
+    return mySize > 0U ? myData[wrap(myHead + N - 1U)] : T{};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+double StatWindow<T, N>::mean() const noexcept
+{
+    return mySize > 0U ? myOffset + mySum / mySize : 0.0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+double StatWindow<T, N>::variance() const noexcept
+{
+    if (mySize == 0U) { return 0.0; }
+    const auto average{mySum / mySize};
+    const auto variance{mySumOfSquares / mySize - average * average};
+
+    // Clamp rounding errors of the running sums.
+    return variance > 0.0 ? variance : 0.0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T StatWindow<T, N>::min() const noexcept
+{
+    return mySize > 0U ? myData[myMinDeque.slots[myMinDeque.first]] : T{};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T StatWindow<T, N>::max() const noexcept
+{
+    return mySize > 0U ? myData[myMaxDeque.slots[myMaxDeque.first]] : T{};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+size_t StatWindow<T, N>::wrap(const size_t index) noexcept
+{
+    // The index never exceeds 2N - 1, hence no division is needed.
+    return index >= N ? index - N : index;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void StatWindow<T, N>::evict(Deque& deque, const size_t slot) noexcept
+{
+    // The evicted sample is the oldest one, hence it can only be at the front.
+    if ((deque.count > 0U) && (deque.slots[deque.first] == slot))
+    {
+        deque.first = wrap(deque.first + 1U);
+        --deque.count;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void StatWindow<T, N>::recomputeSums() noexcept
+{
+    // Only called once the ring is full, center the new sums at the current mean.
+    myOffset      += mySum / N;
+    mySum          = 0.0;
+    mySumOfSquares = 0.0;
+
+    for (const auto& sample : myData)
+    {
+        const auto value{static_cast<double>(sample) - myOffset};
+        mySum          += value;
+        mySumOfSquares += value * value;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void StatWindow<T, N>::insert(Deque& deque, const size_t slot, const bool keepMin) noexcept
+{
+    // Drop samples from the back that can no longer become the extreme.
+    const auto& sample{myData[slot]};
+    while (deque.count > 0U)
+    {
+        const auto& last{myData[deque.slots[wrap(deque.first + deque.count - 1U)]]};
+        if (keepMin ? !(last < sample) : !(sample < last)) { --deque.count; }
+        else { break; }
+    }
+    deque.slots[wrap(deque.first + deque.count)] = slot;
+    ++deque.count;
+}
+} // namespace container
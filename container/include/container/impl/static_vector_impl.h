@@ -0,0 +1,176 @@
+/**
+ * @brief Implementation details of container::StaticVector class.
+ *
+ * @note Don't include this header, use <static_vector.h> instead!
+ */
+#pragma once
+
+#include "utils/utils.h"
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+StaticVector<T, N>::StaticVector() noexcept
+    : myData{}
+    , mySize{} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+template <typename... Values>
+StaticVector<T, N>::StaticVector(const Values&&... values) noexcept
+    : StaticVector()
+{
+    (pushBack(values), ...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+StaticVector<T, N>::StaticVector(const StaticVector& other) noexcept
+    : StaticVector()
+{
+    utils::copyValues(myData.data(), other.data(), other.mySize);
+    mySize = other.mySize;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+StaticVector<T, N>& StaticVector<T, N>::operator=(const StaticVector& other) noexcept
+{
+    if (this != &other)
+    {
+        // Reset the elements beyond the new size to release any resources they hold.
+        if (other.mySize < mySize)
+        {
+            utils::fillValues(myData.data() + other.mySize, T{}, mySize - other.mySize);
+        }
+        utils::copyValues(myData.data(), other.data(), other.mySize);
+        mySize = other.mySize;
+    }
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T& StaticVector<T, N>::operator[](const size_t index) noexcept { return myData[index]; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+const T& StaticVector<T, N>::operator[](const size_t index) const noexcept
+{
+    return myData[index];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T* StaticVector<T, N>::data() noexcept { return myData.data(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+const T* StaticVector<T, N>::data() const noexcept { return myData.data(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+size_t StaticVector<T, N>::size() const noexcept { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool StaticVector<T, N>::empty() const noexcept { return mySize == 0U; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool StaticVector<T, N>::full() const noexcept { return mySize == N; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename StaticVector<T, N>::Iterator StaticVector<T, N>::begin() noexcept
+{
+    return myData.begin();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename StaticVector<T, N>::ConstIterator StaticVector<T, N>::begin() const noexcept
+{
+    return myData.begin();
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename StaticVector<T, N>::Iterator StaticVector<T, N>::end() noexcept
+{
+    return Iterator{myData.data() + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+typename StaticVector<T, N>::ConstIterator StaticVector<T, N>::end() const noexcept
+{
+    return ConstIterator{myData.data() + mySize};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+T* StaticVector<T, N>::last() noexcept
+{
+    return mySize > 0U ? myData.data() + mySize - 1U : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+const T* StaticVector<T, N>::last() const noexcept
+{
+    return mySize > 0U ? myData.data() + mySize - 1U : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+void StaticVector<T, N>::clear() noexcept
+{
+    // Reset the elements to release any resources they hold.
+    utils::fillValues(myData.data(), T{}, mySize);
+    mySize = 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool StaticVector<T, N>::resize(const size_t newSize) noexcept
+{
+    if (newSize > N) { return false; }
+
+    // Reset the removed elements, or value-initialize the added elements.
+    if (newSize < mySize) { utils::fillValues(myData.data() + newSize, T{}, mySize - newSize); }
+    else { utils::fillValues(myData.data() + mySize, T{}, newSize - mySize); }
+    mySize = newSize;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool StaticVector<T, N>::pushBack(const T& value) noexcept
+{
+    if (full()) { return false; }
+    myData[mySize++] = value;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool StaticVector<T, N>::pushBack(T&& value) noexcept
+{
+    if (full()) { return false; }
+    myData[mySize++] = utils::move(value);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t N>
+bool StaticVector<T, N>::popBack() noexcept
+{
+    if (empty()) { return false; }
+
+    // Reset the popped element to release any resources it holds.
+    myData[--mySize] = T{};
+    return true;
+}
+} // namespace container
@@ -5,6 +5,8 @@
  */
 #pragma once 
 
+#include <string.h>
+
 #include "utils/utils.h"
 
 namespace container
@@ -13,7 +15,8 @@ namespace container
 template <typename T>
 Vector<T>::Vector() noexcept
     : myData{nullptr}
-    , mySize{} {}
+    , mySize{}
+    , myCapacity{} {}
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -29,8 +32,8 @@ template <typename... Values>
 Vector<T>::Vector(const Values&&... values) noexcept
     : Vector()
 {
-    const T array[sizeof...(values)]{(values)...};
-    addValues(array);
+    if (!reserve(sizeof...(values))) { return; }
+    (utils::construct(myData + mySize++, values), ...);
 }
 
 // -----------------------------------------------------------------------------
@@ -46,10 +49,12 @@ template <typename T>
 Vector<T>::Vector(Vector&& other) noexcept
     : Vector()
 {
-    myData       = other.myData;
-    mySize       = other.mySize;
-    other.myData = nullptr;
-    other.mySize = 0U;
+    myData           = other.myData;
+    mySize           = other.mySize;
+    myCapacity       = other.myCapacity;
+    other.myData     = nullptr;
+    other.mySize     = 0U;
+    other.myCapacity = 0U;
 }
 
 // -----------------------------------------------------------------------------
@@ -73,10 +78,12 @@ template <typename T>
 Vector<T>& Vector<T>::operator=(Vector<T>&& other) noexcept
 {
     clear();
-    myData       = other.myData;
-    mySize       = other.mySize;
-    other.myData = nullptr;
-    other.mySize = 0U;
+    myData           = other.myData;
+    mySize           = other.mySize;
+    myCapacity       = other.myCapacity;
+    other.myData     = nullptr;
+    other.mySize     = 0U;
+    other.myCapacity = 0U;
     return *this;
 }
 
@@ -121,6 +128,10 @@ const T& Vector<T>::operator[](const size_t index) const noexcept
     return myData[index]; 
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+T* Vector<T>::data() noexcept { return myData; }
+
 // -----------------------------------------------------------------------------
 template <typename T>
 const T* Vector<T>::data() const noexcept { return myData; }
@@ -129,6 +140,10 @@ const T* Vector<T>::data() const noexcept { return myData; }
 template <typename T>
 size_t Vector<T>::size() const noexcept { return mySize; }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t Vector<T>::capacity() const noexcept { return myCapacity; }
+
 // -----------------------------------------------------------------------------
 template <typename T>
 bool Vector<T>::empty() const noexcept { return mySize == 0U; }
@@ -188,38 +203,95 @@ typename Vector<T>::ConstIterator Vector<T>::rend() const noexcept
 
 // -----------------------------------------------------------------------------
 template <typename T>
-T* Vector<T>::last() noexcept { return mySize > 0U ? end() - 1U : nullptr; }
+T* Vector<T>::last() noexcept { return mySize > 0U ? myData + mySize - 1U : nullptr; }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-const T* Vector<T>::last() const noexcept { return mySize > 0U ? end() - 1U : nullptr; }
+const T* Vector<T>::last() const noexcept { return mySize > 0U ? myData + mySize - 1U : nullptr; }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 void Vector<T>::clear() noexcept 
 {
+    utils::destroy(myData, mySize);
     utils::deleteMemory<T>(myData);
-    myData = nullptr;
-    mySize = 0U;
+    myData     = nullptr;
+    mySize     = 0U;
+    myCapacity = 0U;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 bool Vector<T>::resize(const size_t newSize) noexcept 
 {
-    auto copy{utils::reallocMemory<T>(myData, newSize)};
-    if (copy == nullptr) { return false; }
-    myData = copy;
+    if (newSize < mySize)
+    {
+        utils::destroy(myData + newSize, mySize - newSize);
+    }
+    else
+    {
+        if (!grow(newSize)) { return false; }
+
+        // Value initialization of trivial types sets all bits to zero.
+        if constexpr (type_traits::is_trivial<T>::value)
+        {
+            utils::fillValues(myData + mySize, T{}, newSize - mySize);
+        }
+        else
+        {
+            for (size_t i{mySize}; i < newSize; ++i) { utils::construct(myData + i); }
+        }
+    }
     mySize = newSize;
     return true;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-bool Vector<T>::pushBack(const T& value) noexcept 
+bool Vector<T>::reserve(const size_t capacity) noexcept 
 {
-    if (!resize(mySize + 1U)) { return false; }
-    myData[mySize - 1U] = value;
+    return capacity <= myCapacity ? true : reallocate(capacity);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::shrinkToFit() noexcept 
+{
+    if (mySize == myCapacity) { return true; }
+
+    if (mySize == 0U) 
+    { 
+        clear(); 
+        return true;
+    }
+    return reallocate(mySize);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::pushBack(const T& value) noexcept { return emplaceBack(value); }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::pushBack(T&& value) noexcept { return emplaceBack(utils::move(value)); }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename... Args>
+bool Vector<T>::emplaceBack(Args&&... args) noexcept 
+{
+    if (mySize < myCapacity)
+    {
+        utils::construct(myData + mySize, utils::forward<Args>(args)...);
+    }
+    else
+    {
+        // Construct the value first, since the arguments may refer to elements of this vector.
+        T value(utils::forward<Args>(args)...);
+        if (!grow(mySize + 1U)) { return false; }
+        utils::construct(myData + mySize, utils::move(value));
+    }
+    ++mySize;
     return true;
 }
 
@@ -227,54 +299,182 @@ bool Vector<T>::pushBack(const T& value) noexcept
 template <typename T>
 bool Vector<T>::popBack() noexcept 
 {
-    if (mySize <= 1U) 
+    if (mySize > 0U) { utils::destroy(myData + --mySize); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::insert(const size_t index, const T& value) noexcept 
+{ 
+    return emplace(index, value);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::insert(const size_t index, T&& value) noexcept 
+{ 
+    return emplace(index, utils::move(value));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::insert(const size_t index, const T* first, const T* last) noexcept 
+{
+    if ((index > mySize) || (first > last)) { return false; }
+    const auto count{static_cast<size_t>(last - first)};
+    if (count == 0U) { return true; }
+
+    // Insert a copy if the values are elements of this vector, since they're moved by the shift.
+    if ((first >= myData) && (first < myData + mySize))
     {
-        clear();
-        return true;
-    } 
-    else 
+        Vector<T> copy{};
+        if (!copy.reserve(count)) { return false; }
+        copy.assign(first, count);
+        copy.mySize = count;
+        return insert(index, copy.myData, copy.myData + count);
+    }
+
+    const auto oldSize{mySize};
+    if (!openGap(index, count)) { return false; }
+
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        utils::copyValues(myData + index, first, count);
+    }
+    else
     {
-        return resize(mySize - 1U);
+        for (size_t i{}; i < count; ++i) { fillGap(index + i, oldSize, first[i]); }
     }
+    return true;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-bool Vector<T>::copy(const Vector<T>& other) noexcept 
+template <typename... Args>
+bool Vector<T>::emplace(const size_t index, Args&&... args) noexcept 
+{
+    if (index > mySize) { return false; }
+    if (index == mySize) { return emplaceBack(utils::forward<Args>(args)...); }
+
+    // Construct the value first, since the arguments may refer to elements of this vector.
+    T value(utils::forward<Args>(args)...);
+    const auto oldSize{mySize};
+    if (!openGap(index, 1U)) { return false; }
+    fillGap(index, oldSize, utils::move(value));
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::erase(const size_t index) noexcept 
+{ 
+    return erase(index, index + 1U);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::erase(const size_t first, const size_t last) noexcept 
 {
-    if (!resize(other.mySize)) { return false; }
-    assign(other);
+    if ((first > last) || (last > mySize)) { return false; }
+    const auto count{last - first};
+
+    // Shift the subsequent elements over the erased ones, then destroy the vacated tail.
+    utils::moveValues(myData + first, myData + last, mySize - last);
+    utils::destroy(myData + mySize - count, count);
+    mySize -= count;
     return true;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-void Vector<T>::assign(const Vector<T>& other, const size_t offset) noexcept 
+template <typename Predicate>
+size_t Vector<T>::eraseIf(const Predicate& predicate) noexcept 
 {
-    for (size_t i{}; offset + i < mySize && i < other.mySize; ++i) 
+    size_t newSize{};
+
+    // Move each value to keep to the next free position, then destroy the vacated tail.
+    for (size_t i{}; i < mySize; ++i)
     {
-        myData[offset + i] = other.myData[i];
+        if (predicate(myData[i])) { continue; }
+        if (newSize != i) { myData[newSize] = utils::move(myData[i]); }
+        ++newSize;
     }
+    const auto erasedCount{mySize - newSize};
+    utils::destroy(myData + newSize, erasedCount);
+    mySize = newSize;
+    return erasedCount;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-template <size_t ValueCount>
-void Vector<T>::assign(const T (&values)[ValueCount], const size_t offset) noexcept 
+bool Vector<T>::openGap(const size_t index, const size_t count) noexcept 
+{
+    // Make room for count values at given index by shifting the subsequent elements back.
+    if (!grow(mySize + count)) { return false; }
+
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        utils::moveValues(myData + index + count, myData + index, mySize - index);
+    }
+    else
+    {
+        // Elements shifted beyond the old end are constructed, the others are assigned.
+        for (size_t i{mySize}; i > index; --i)
+        {
+            const auto destination{i - 1U + count};
+            if (destination >= mySize) 
+            { 
+                utils::construct(myData + destination, utils::move(myData[i - 1U]));
+            }
+            else { myData[destination] = utils::move(myData[i - 1U]); }
+        }
+    }
+    mySize += count;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename Value>
+void Vector<T>::fillGap(const size_t index, const size_t oldSize, Value&& value) noexcept 
 {
-    for (size_t i{}; i < ValueCount && offset + i < mySize; ++i) 
+    // Positions within the old size hold moved-from elements, the others are uninitialized.
+    if (index < oldSize) { myData[index] = utils::forward<Value>(value); }
+    else { utils::construct(myData + index, utils::forward<Value>(value)); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::copy(const Vector<T>& other) noexcept 
+{
+    return addValues(other);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void Vector<T>::assign(const T* values, const size_t count) noexcept 
+{
+    // Copy-construct the values at the back of the vector, the capacity must be sufficient.
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
     {
-        myData[offset + i] = values[i];
+        if (count > 0U) { memcpy(myData + mySize, values, count * sizeof(T)); }
     }
+    else
+    {
+        for (size_t i{}; i < count; ++i) { utils::construct(myData + mySize + i, values[i]); }
+    }
+    mySize += count;
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
 bool Vector<T>::addValues(const Vector<T>& other) noexcept 
 {
-    const auto offset{mySize};
-    if (!resize(mySize + other.mySize)) { return false; }
-    assign(other, offset);
+    // Read the data after growing, since other may refer to this vector.
+    const auto count{other.mySize};
+    if (!grow(mySize + count)) { return false; }
+    assign(other.myData, count);
     return true;
 }
 
@@ -283,9 +483,46 @@ template <typename T>
 template <size_t ValueCount>
 bool Vector<T>::addValues(const T (&values)[ValueCount]) noexcept 
 {
-    const auto offset{mySize};
-    if (!resize(mySize + ValueCount)) { return false; }
-    assign(values, offset);
+    if (!grow(mySize + ValueCount)) { return false; }
+    assign(values, ValueCount);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::grow(const size_t newSize) noexcept 
+{
+    // Grow geometrically to make repeated appends amortized O(1).
+    if (newSize <= myCapacity) { return true; }
+    const auto doubleCapacity{2U * myCapacity};
+    return reallocate(newSize > doubleCapacity ? newSize : doubleCapacity);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Vector<T>::reallocate(const size_t newCapacity) noexcept 
+{
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        auto copy{utils::reallocMemory<T>(myData, newCapacity)};
+        if (copy == nullptr) { return false; }
+        myData = copy;
+    }
+    else
+    {
+        // Move the elements to the new memory, then destroy the old elements.
+        auto copy{utils::newMemory<T>(newCapacity)};
+        if (copy == nullptr) { return false; }
+
+        for (size_t i{}; i < mySize; ++i) 
+        { 
+            utils::construct(copy + i, utils::move(myData[i])); 
+        }
+        utils::destroy(myData, mySize);
+        utils::deleteMemory<T>(myData);
+        myData = copy;
+    }
+    myCapacity = newCapacity;
     return true;
 }
 } // namespace container
@@ -0,0 +1,279 @@
+/**
+ * @brief Implementation of intrusive doubly linked lists.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "container/iterator/node_iterator.h"
+
+namespace container
+{
+template <typename T>
+class IntrusiveList;
+
+/**
+ * @brief Class for implementation of intrusive list hooks.
+ *
+ *        Types to store in an intrusive list shall publicly inherit this class. The hook holds
+ *        the links of the element, hence no memory is allocated when linking the element.
+ *        The hook also records the list it's linked into, so that lists refuse to unlink
+ *        elements they don't hold.
+ *
+ *        An element can be linked into one list at a time and shall be removed from the list
+ *        before it's deleted. This class is non-copyable and non-movable, since copying the
+ *        links would corrupt the list.
+ */
+class IntrusiveListHook
+{
+public:
+    /**
+     * @brief Create unlinked hook.
+     */
+    IntrusiveListHook() noexcept
+        : myPrevious{nullptr}
+        , myNext{nullptr}
+        , myOwner{nullptr} {}
+
+    /**
+     * @brief Delete hook.
+     */
+    ~IntrusiveListHook() noexcept = default;
+
+    /**
+     * @brief Check if the hook is linked into a list.
+     *
+     * @return True if the hook is linked into a list, false otherwise.
+     */
+    bool isLinked() const noexcept { return myNext != nullptr; }
+
+    IntrusiveListHook(const IntrusiveListHook&)            = delete; // No copy constructor.
+    IntrusiveListHook(IntrusiveListHook&&)                 = delete; // No move constructor.
+    IntrusiveListHook& operator=(const IntrusiveListHook&) = delete; // No copy assignment.
+    IntrusiveListHook& operator=(IntrusiveListHook&&)      = delete; // No move assignment.
+
+private:
+    template <typename T>
+    friend class IntrusiveList;
+
+    /** Pointer to previous hook. */
+    IntrusiveListHook* myPrevious;
+
+    /** Pointer to next hook, nullptr if the hook isn't linked. */
+    IntrusiveListHook* myNext;
+
+    /** Pointer to the list the hook is linked into, nullptr if the hook isn't linked. */
+    const void* myOwner;
+};
+
+/**
+ * @brief Class for implementation of intrusive doubly linked lists.
+ *
+ *        The list links existing elements via their hooks instead of storing copies in
+ *        allocated nodes, hence linking and unlinking elements never allocates memory.
+ *        Elements are unlinked by reference in constant time. The list doesn't own its
+ *        elements, which must outlive their membership in the list.
+ *
+ *        The list is circular around a sentinel hook, which serves as end iterator.
+ *        This class is non-copyable and non-movable, since the elements refer to the sentinel.
+ *
+ * @tparam T The element type, which must publicly inherit IntrusiveListHook.
+ */
+template <typename T>
+class IntrusiveList
+{
+    static_assert(__is_base_of(IntrusiveListHook, T),
+                  "Intrusive list elements must inherit IntrusiveListHook!");
+
+    /** Accessor to the links and elements of the hooks, used by the iterators. */
+    struct HookAccess;
+
+public:
+    /** List iterator. */
+    using Iterator = NodeIterator<HookAccess, false>;
+
+    /** Constant list iterator. */
+    using ConstIterator = NodeIterator<HookAccess, true>;
+
+    /**
+     * @brief Create empty list.
+     */
+    IntrusiveList() noexcept;
+
+    /**
+     * @brief Delete list. All elements are unlinked.
+     */
+    ~IntrusiveList() noexcept;
+
+    /**
+     * @brief Get the size of the list.
+     *
+     * @return The size of the list as the number of linked elements.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Check if the list is empty.
+     *
+     * @return True if the list is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Get the first element of the list.
+     *
+     * @return Pointer to the first element, or a nullptr if the list is empty.
+     */
+    T* front() noexcept;
+
+    /**
+     * @brief Get the first element of the list.
+     *
+     * @return Pointer to the first element, or a nullptr if the list is empty.
+     */
+    const T* front() const noexcept;
+
+    /**
+     * @brief Get the last element of the list.
+     *
+     * @return Pointer to the last element, or a nullptr if the list is empty.
+     */
+    T* back() noexcept;
+
+    /**
+     * @brief Get the last element of the list.
+     *
+     * @return Pointer to the last element, or a nullptr if the list is empty.
+     */
+    const T* back() const noexcept;
+
+    /**
+     * @brief Get the beginning of list.
+     *
+     * @return Iterator pointing at the beginning of list.
+     */
+    Iterator begin() noexcept;
+
+    /**
+     * @brief Get the beginning of list.
+     *
+     * @return Iterator pointing at the beginning of list.
+     */
+    ConstIterator begin() const noexcept;
+
+    /**
+     * @brief Get the end of list.
+     *
+     * @return Iterator pointing at the end of list.
+     */
+    Iterator end() noexcept;
+
+    /**
+     * @brief Get the end of list.
+     *
+     * @return Iterator pointing at the end of list.
+     */
+    ConstIterator end() const noexcept;
+
+    /**
+     * @brief Get the reverse beginning of list.
+     *
+     * @return Iterator pointing at the reverse beginning of list.
+     */
+    Iterator rbegin() noexcept;
+
+    /**
+     * @brief Get the reverse beginning of list.
+     *
+     * @return Iterator pointing at the reverse beginning of list.
+     */
+    ConstIterator rbegin() const noexcept;
+
+    /**
+     * @brief Get the reverse end of list.
+     *
+     * @return Iterator pointing at the reverse end of list.
+     */
+    Iterator rend() noexcept;
+
+    /**
+     * @brief Get the reverse end of list.
+     *
+     * @return Iterator pointing at the reverse end of list.
+     */
+    ConstIterator rend() const noexcept;
+
+    /**
+     * @brief Link element at the front of list.
+     *
+     * @param[in] element Reference to the element to link.
+     *
+     * @return True if the element was linked, false if it's already linked into a list.
+     */
+    bool pushFront(T& element) noexcept;
+
+    /**
+     * @brief Link element at the back of list.
+     *
+     * @param[in] element Reference to the element to link.
+     *
+     * @return True if the element was linked, false if it's already linked into a list.
+     */
+    bool pushBack(T& element) noexcept;
+
+    /**
+     * @brief Link element before given position in the list.
+     *
+     * @param[in] iterator Reference to iterator pointing at the location to place the element.
+     * @param[in] element  Reference to the element to link.
+     *
+     * @return True if the element was linked, false if it's already linked into a list.
+     */
+    bool insert(const Iterator& iterator, T& element) noexcept;
+
+    /**
+     * @brief Unlink element at the front of list.
+     *
+     * @return Pointer to the unlinked element, or a nullptr if the list is empty.
+     */
+    T* popFront() noexcept;
+
+    /**
+     * @brief Unlink element at the back of list.
+     *
+     * @return Pointer to the unlinked element, or a nullptr if the list is empty.
+     */
+    T* popBack() noexcept;
+
+    /**
+     * @brief Unlink given element from the list in constant time.
+     *
+     * @param[in] element Reference to the element to unlink.
+     *
+     * @return True if the element was unlinked, false if it isn't linked into this list.
+     */
+    bool remove(T& element) noexcept;
+
+    /**
+     * @brief Unlink all elements of the list.
+     */
+    void clear() noexcept;
+
+    IntrusiveList(const IntrusiveList&)            = delete; // No copy constructor.
+    IntrusiveList(IntrusiveList&&)                 = delete; // No move constructor.
+    IntrusiveList& operator=(const IntrusiveList&) = delete; // No copy assignment.
+    IntrusiveList& operator=(IntrusiveList&&)      = delete; // No move assignment.
+
+private:
+    static void link(IntrusiveListHook& hook, IntrusiveListHook& next) noexcept;
+    static void unlink(IntrusiveListHook& hook) noexcept;
+
+    /** Sentinel hook, linked to the first and last elements. */
+    IntrusiveListHook myRoot;
+
+    /** The size of the list in number of elements. */
+    size_t mySize;
+};
+} // namespace container
+
+#include "impl/intrusive_list_impl.h"
@@ -0,0 +1,231 @@
+/**
+ * @brief Implementation of linked node iterators, shared by the linked list containers.
+ */
+#pragma once
+
+#include "utils/type_traits.h"
+
+namespace container
+{
+/**
+ * @brief Implementation of bidirectional iterators over linked nodes.
+ * 
+ *        The iterator is parameterized on a node accessor, which gives the iterator access 
+ *        to the links and value of each node. This way List and IntrusiveList share the 
+ *        same iterator, although their nodes differ. The accessor shall provide:
+ * 
+ *            using Node  = ...; // The node type, e.g. a list node or a hook.
+ *            using Value = ...; // The type of the values held by the nodes.
+ *            static Node* next(const Node& node) noexcept;
+ *            static Node* previous(const Node& node) noexcept;
+ *            static Value& value(Node& node) noexcept;
+ *            static const Value& value(const Node& node) noexcept;
+ *
+ * @tparam Access  The node accessor.
+ * @tparam IsConst True for constant iterators, which only provide read access to the values.
+ */
+template <typename Access, bool IsConst>
+class NodeIterator final
+{
+    /** The node type, const for constant iterators. */
+    using Node = typename type_traits::conditional<IsConst, const typename Access::Node, 
+                                                   typename Access::Node>::type;
+
+    /** The value type, const for constant iterators. */
+    using Value = typename type_traits::conditional<IsConst, const typename Access::Value, 
+                                                    typename Access::Value>::type;
+
+    /** The node address type, const for constant iterators. */
+    using Address = typename type_traits::conditional<IsConst, const void*, void*>::type;
+
+public:
+    /**
+     * @brief Create empty iterator.
+     */
+    NodeIterator() noexcept
+        : myNode{nullptr} {}
+
+    /**
+     * @brief Create iterator pointing at given node.
+     *
+     * @param[in] node Reference to node the iterator is to point at.
+     */
+    NodeIterator(Node& node) noexcept
+        : myNode{&node} {}
+
+    /**
+     * @brief Create iterator pointing at given node.
+     *
+     * @param[in] node Pointer to node the iterator is to point at.
+     */
+    NodeIterator(Node* node) noexcept
+        : myNode{node} {}
+
+    /**
+     * @brief Delete iterator.
+     */
+    ~NodeIterator() noexcept = default;
+
+    /**
+     * @brief Create copy of another iterator.
+     * 
+     * @param[in] other Reference to iterator to copy.
+     */
+    NodeIterator(const NodeIterator& other) noexcept
+        : myNode{other.myNode} {}
+
+    /**
+     * @brief Create iterator overtaking resources from another iterator.
+     * 
+     *        The other iterator is set to null after the move operation is completed.
+     * 
+     * @param[in] other Reference to iterator to move resources from.
+     */
+    NodeIterator(NodeIterator&& other) noexcept
+        : myNode{other.myNode} { other.myNode = nullptr; }
+
+    /**
+     * @brief Copy another iterator.
+     * 
+     * @param[in] other Reference to iterator to copy.
+     * 
+     * @return Reference to this iterator.
+     */
+    NodeIterator& operator=(const NodeIterator& other) noexcept 
+    { 
+        if (this != &other) { myNode = other.myNode; }
+        return *this;
+    }
+
+    /**
+     * @brief Move resources from another iterator.
+     * 
+     *        The other iterator is set to null after the move operation is completed.
+     * 
+     * @param[in] other Reference to iterator to move resources from.
+     * 
+     * @return Reference to this iterator.
+     */
+    NodeIterator& operator=(NodeIterator&& other) noexcept
+    {
+        if (this != &other)
+        {
+            myNode       = other.myNode;
+            other.myNode = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Set iterator to point at next node (prefix operator).
+     * 
+     * @return Reference to this iterator.
+     */
+    NodeIterator& operator++() noexcept
+    {
+        myNode = Access::next(*myNode);
+        return *this;
+    }
+
+    /**
+     * @brief Set iterator to point at previous node (prefix operator).
+     * 
+     * @return Reference to this iterator.
+     */
+    NodeIterator& operator--() noexcept
+    {
+        myNode = Access::previous(*myNode);
+        return *this;
+    }
+
+    /**
+     * @brief Set iterator to point at next node (postfix operator).
+     * 
+     * @return The previous state of this iterator.
+     */
+    NodeIterator operator++(int) noexcept
+    {
+        auto previous{*this};
+        myNode = Access::next(*myNode);
+        return previous;
+    }
+
+    /**
+     * @brief Set iterator to point at previous node (postfix operator).
+     * 
+     * @return The previous state of this iterator.
+     */
+    NodeIterator operator--(int) noexcept
+    {
+        auto previous{*this};
+        myNode = Access::previous(*myNode);
+        return previous;
+    }
+
+    /**
+     * @brief Increment the iterator given number of times.
+     *
+     * @param[in] incrementCount The number of times the iterator will be incremented.
+     */
+    void operator+=(const size_t incrementCount) noexcept
+    {
+        for (size_t i{}; i < incrementCount; ++i) { myNode = Access::next(*myNode); }
+    }
+
+    /**
+     * @brief Decrement the iterator given number of times.
+     *
+     * @param[in] decrementCount The number of times the iterator will be decremented.
+     */
+    void operator-=(const size_t decrementCount) noexcept
+    {
+        for (size_t i{}; i < decrementCount; ++i) { myNode = Access::previous(*myNode); }
+    }
+
+    /**
+     * @brief Check if the iterator and referenced other iterator point at the same node.
+     *
+     * @param[in] other Reference to other iterator.
+     * 
+     * @return True if the iterators point at the same node, false otherwise.
+     */
+    bool operator==(const NodeIterator& other) const noexcept { return myNode == other.myNode; }
+
+    /**
+     * @brief Check if the iterator and referenced other iterator point at different nodes.
+     *
+     * @param[in] other Reference to other iterator.
+     * 
+     * @return True if the iterators point at different nodes, false otherwise.
+     */
+    bool operator!=(const NodeIterator& other) const noexcept { return myNode != other.myNode; }
+
+    /**
+     * @brief Get the value held by the node the iterator is pointing at.
+     *
+     * @return Reference to the value held by the node the iterator is pointing at.
+     */
+    Value& operator*() noexcept { return Access::value(*myNode); }
+
+    /**
+     * @brief Get the value held by the node the iterator is pointing at.
+     *
+     * @return Reference to the value held by the node the iterator is pointing at.
+     */
+    const Value& operator*() const noexcept { return Access::value(*myNode); }
+
+    /**
+     * @brief Get the address of the node the iterator is pointing at. 
+     * 
+     * @note A void pointer is returned to keep information about nodes 
+     *       private within the containers.
+     *
+     * @return Pointer to the node the iterator is pointing at.
+     */
+    Address address() const noexcept { return myNode; }
+
+private:
+    /** Pointer to the node this iterator is referring to. */
+    Node* myNode;
+};
+} // namespace container
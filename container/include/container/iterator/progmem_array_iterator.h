@@ -0,0 +1,245 @@
+/**
+ * @brief Implementation of program memory array iterators.
+ * 
+ * @note This file is included in <progmem_array.h> and shall not be included directly.
+ */
+#pragma once
+
+namespace container
+{
+/**
+ * @brief Implementation of constant program memory array iterators.
+ *
+ * @tparam T    The array type.
+ * @tparam Size The array size. Must be greater than 0.
+ */
+template <typename T, size_t Size>
+class ProgmemArray<T, Size>::ConstIterator
+{
+public:
+    /**
+     * @brief Create empty iterator.
+     */
+    constexpr ConstIterator() noexcept
+        : myData{nullptr} {}
+
+    /**
+     * @brief Create iterator pointing at given data.
+     *
+     * @param[in] data Reference to data the iterator is set to point at.
+     */
+    constexpr ConstIterator(const T& data) noexcept
+        : myData{&data} {}
+
+    /**
+     * @brief Create iterator pointing at given data.
+     *
+     * @param[in] data Pointer to data the iterator is set to point at.
+     */
+    constexpr ConstIterator(const T* data) noexcept
+        : myData{data} {}
+
+    /**
+     * @brief Delete iterator.
+     */
+    ~ConstIterator() noexcept = default;
+
+    /**
+     * @brief Create copy of another iterator.
+     * 
+     * @param[in] other Reference to iterator to copy.
+     */
+    constexpr ConstIterator(const ConstIterator& other) noexcept
+        : myData{other.myData} {}
+
+    /**
+     * @brief Create iterator overtaking resources from another iterator.
+     * 
+     *        The other iterator is set to null after the move operation is completed.
+     * 
+     * @param[in] other Reference to iterator to move resources from.
+     */
+    constexpr ConstIterator(ConstIterator&& other) noexcept
+        : myData{other.myData} { other.myData = nullptr; }
+
+    /**
+     * @brief Copy another iterator.
+     * 
+     * @param[in] other Reference to iterator to copy.
+     * 
+     * @return Reference to this iterator.
+     */
+    constexpr ConstIterator& operator=(const ConstIterator& other) noexcept
+    {
+        if (this != &other) { myData = other.myData; }
+        return *this;
+    }
+
+    /**
+     * @brief Move resources from another iterator.
+     * 
+     *        The other iterator is set to null after the move operation is completed.
+     * 
+     * @param[in] other Reference to iterator to move resources from.
+     * 
+     * @return Reference to this iterator.
+     */
+    constexpr ConstIterator& operator=(ConstIterator&& other) noexcept
+    {
+        if (this != &other)
+        {
+            myData       = other.myData;
+            other.myData = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Increment the address the iterator is pointing at (prefix operator).
+     * 
+     * @return Reference to this iterator.
+     */
+    constexpr ConstIterator& operator++() noexcept
+    {
+        ++myData;
+        return *this;
+    }
+
+    /**
+     * @brief Decrement the address the iterator is pointing at (prefix operator).
+     * 
+     * @return Reference to this iterator.
+     */
+    constexpr ConstIterator& operator--() noexcept
+    {
+        --myData;
+        return *this;
+    }
+
+    /**
+     * @brief Increment the address the iterator is pointing at (postfix operator).
+     * 
+     * @return The previous state of this iterator.
+     */
+    constexpr ConstIterator operator++(int) noexcept
+    {
+        auto previous{*this};
+        ++myData;
+        return previous;
+    }
+
+    /**
+     * @brief Decrement the address the iterator is pointing at (postfix operator).
+     * 
+     * @return The previous state of this iterator.
+     */
+    constexpr ConstIterator operator--(int) noexcept
+    {
+        auto previous{*this};
+        --myData;
+        return previous;
+    }
+
+    /**
+     * @brief Increment the iterator given number of times.
+     *
+     * @param[in] incrementCount The number of times the iterator will be incremented.
+     */
+    constexpr void operator+=(const size_t incrementCount) noexcept
+    {
+        myData += incrementCount;
+    }
+
+    /**
+     * @brief Decrement the iterator given number of times.
+     *
+     * @param[in] decrementCount The number of times the iterator will be decremented.
+     */
+    constexpr void operator-=(const size_t decrementCount) noexcept
+    {
+        myData -= decrementCount;
+    }
+
+    /**
+     * @brief Get the distance between the iterator and referenced other iterator.
+     *
+     * @param[in] other Reference to other iterator.
+     * 
+     * @return The number of elements from the other iterator to this iterator.
+     */
+    constexpr ptrdiff_t operator-(const ConstIterator& other) const noexcept { return myData - other.myData; }
+
+    /**
+     * @brief Check if the iterator and referenced other iterator point at the same address.
+     *
+     * @param[in] other Reference to other iterator.
+     * 
+     * @return True if the iterators point at the same address, false otherwise.
+     */
+    constexpr bool operator==(const ConstIterator& other) const noexcept { return myData == other.myData; }
+
+    /**
+     * @brief Check if the iterator and referenced other iterator point at different addresses.
+     *
+     * @param[in] other Reference to other iterator.
+     * 
+     * @return True if the iterators point at the different addresses, false otherwise.
+     */
+    constexpr bool operator!=(const ConstIterator& other) const noexcept { return myData != other.myData; }
+
+    /**
+     * @brief Check if the iterator points at an address that's higher than
+     *        the address pointed to by referenced other iterator.
+     *
+     * @param[in] other Reference to other iterator.
+     * 
+     * @return True if iterator points at an address that's higher than the address
+     *         pointed to by referenced other iterator, false otherwise.
+     */
+    constexpr bool operator>(const ConstIterator& other) const noexcept { return myData > other.myData; }
+
+    /**
+     * @brief Check if the iterator points at an address that's lower than
+     *        the address pointed to by referenced other iterator.
+     *
+     * @param[in] other Reference to other iterator.
+     * 
+     * @return True if iterator points at an address that's lower than the address
+     *         pointed to by referenced other iterator, false otherwise.
+     */
+    constexpr bool operator<(const ConstIterator& other) const noexcept { return myData < other.myData; }
+
+    /**
+     * @brief Check if the iterator points at an address that's higher or equal
+     *        to the address pointed to by referenced other iterator.
+     *
+     * @param[in] other Reference to other iterator.
+     * 
+     * @return True if iterator points at an address that's higher or equal to the
+     *         address pointed to by referenced other iterator, false otherwise.
+     */
+    constexpr bool operator>=(const ConstIterator& other) const noexcept { return myData >= other.myData; }
+
+    /**
+     * @brief Check if the iterator points at an address that's lower or equal
+     *        to the address pointed to by referenced other iterator.
+     *
+     * @param[in] other Reference to other iterator.
+     * 
+     * @return True if iterator points at an address that's lower or equal to the
+     *         address pointed to by referenced other iterator, false otherwise.
+     */
+    constexpr bool operator<=(const ConstIterator& other) const noexcept { return myData <= other.myData; }
+
+    /**
+     * @brief Read the value stored at the address the iterator is pointing at.
+     *
+     * @return Copy of the value at the address the iterator is pointing at.
+     */
+    T operator*() const noexcept { return ProgmemArray<T, Size>::read(myData); }
+
+private:
+    /** Pointer to the data in program memory this iterator is referring to. */
+    const T* myData;
+};
+} // namespace container
@@ -146,7 +146,7 @@ public:
      */
     void operator+=(const size_t incrementCount) noexcept
     {
-        for (size_t i{}; i < incrementCount; ++i) { ++myData; }
+        myData += incrementCount;
     }
 
     /**
@@ -156,9 +156,18 @@ public:
      */
     void operator-=(const size_t decrementCount) noexcept
     {
-        for (size_t i{}; i < decrementCount; ++i) { --myData; }
+        myData -= decrementCount;
     }
 
+    /**
+     * @brief Get the distance between the iterator and referenced other iterator.
+     *
+     * @param[in] other Reference to other iterator.
+     * 
+     * @return The number of elements from the other iterator to this iterator.
+     */
+    ptrdiff_t operator-(const Iterator& other) const noexcept { return myData - other.myData; }
+
     /**
      * @brief Check if the iterator and referenced other iterator point at the same address.
      *
@@ -378,7 +387,7 @@ public:
      */
     void operator+=(const size_t incrementCount) noexcept
     {
-        for (size_t i{}; i < incrementCount; ++i) { ++myData; }
+        myData += incrementCount;
     }
 
     /**
@@ -388,9 +397,18 @@ public:
      */
     void operator-=(const size_t decrementCount) noexcept
     {
-        for (size_t i{}; i < decrementCount; ++i) { --myData; }
+        myData -= decrementCount;
     }
 
+    /**
+     * @brief Get the distance between the iterator and referenced other iterator.
+     *
+     * @param[in] other Reference to other iterator.
+     * 
+     * @return The number of elements from the other iterator to this iterator.
+     */
+    ptrdiff_t operator-(const ConstIterator& other) const noexcept { return myData - other.myData; }
+
     /**
      * @brief Check if the iterator and referenced other iterator point at the same address.
      *
@@ -5,22 +5,39 @@
 
 #include <stddef.h>
 
+#include "container/iterator/node_iterator.h"
+#include "memory/pool_allocator.h"
+#include "utils/utils.h"
+
 namespace container 
 {
 /**
  * @brief Class for implementation of doubly linked lists.
  * 
+ *        The nodes are allocated via given allocator. By default, the nodes are taken from 
+ *        unbounded fixed-block pools, which makes node allocation and deallocation O(1) and 
+ *        avoids heap fragmentation. Use memory::NodeAllocator<Capacity> to bound the pools 
+ *        at compile time, or memory::HeapAllocator to allocate each node on the heap.
+ * 
  * @tparam T The list type.
+ * @tparam Allocator The node allocator (default = unbounded fixed-block pools).
  */
-template <typename T>
+template <typename T, typename Allocator = memory::NodeAllocator<>>
 class List
 {        
+protected:
+    /** Node holding data stored in the list. */
+    struct Node;
+
+    /** Accessor to the links and data of the nodes, used by the iterators. */
+    struct NodeAccess;
+
 public:
     /** List iterator. */
-    class Iterator;
+    using Iterator = NodeIterator<NodeAccess, false>;
 
     /** Constant list iterator. */
-    class ConstIterator;
+    using ConstIterator = NodeIterator<NodeAccess, true>;
 
     /**
      * @brief Create empty list.
@@ -37,6 +54,8 @@ public:
 
     /**
      * @brief Create list initialized with values passed as input arguments.
+     * 
+     *        Each value is constructed in place in its node.
      *
      * @tparam Values Parameter pack containing values.
      * 
@@ -55,7 +74,7 @@ public:
      *
      * @param[in] other Reference to other list to copy from.
      */
-    List(const List<T>& other) noexcept;
+    List(const List& other) noexcept;
 
     /**
      * @brief Move memory from another list.
@@ -64,7 +83,7 @@ public:
      *
      * @param[in] other Reference to other list to move memory from.
      */
-    List(List<T>&& other) noexcept;
+    List(List&& other) noexcept;
 
      /**
      * @brief Copy the content of list to assigned list. 
@@ -75,7 +94,7 @@ public:
      * 
      * @return Reference to this list.
      */
-    List<T>& operator=(const List<T>& other) noexcept;
+    List& operator=(const List& other) noexcept;
 
     /**
      * @brief Move the content from other list.
@@ -88,7 +107,7 @@ public:
      * 
      * @return Reference to this list.
      */
-    List<T>& operator=(List<T>&& other) noexcept;
+    List& operator=(List&& other) noexcept;
 
     /**
      * @brief Add values from another list.
@@ -97,7 +116,19 @@ public:
      * 
      * @return Reference to this list.
      */
-    List<T>& operator+=(const List<T>& other) noexcept;
+    List& operator+=(const List& other) noexcept;
+
+    /**
+     * @brief Move the nodes of another list to the back of this list.
+     * 
+     *        No nodes are allocated or copied, hence the operation is O(1). 
+     *        The other list is emptied once the operation is completed.
+     *
+     * @param[in] other Reference to list holding the nodes to move.
+     * 
+     * @return Reference to this list.
+     */
+    List& operator+=(List&& other) noexcept;
 
     /**
      * @brief Push values to the back of list.
@@ -109,7 +140,7 @@ public:
      * @return Reference to this list.
      */
     template <size_t ValueCount>
-    List<T>& operator+=(const T (&values)[ValueCount]) noexcept;
+    List& operator+=(const T (&values)[ValueCount]) noexcept;
 
     /**
      * @brief Get reference to the value at given position in the list.
@@ -223,6 +254,27 @@ public:
      */
     bool pushFront(const T& value) noexcept;
 
+    /**
+     * @brief Move value to the front of list.
+     *
+     * @param[in] value Reference to the value to move.
+     * 
+     * @return True if the value was added, false otherwise.
+     */
+    bool pushFront(T&& value) noexcept;
+
+    /**
+     * @brief Construct value in place at the front of list.
+     *
+     * @tparam Args The type of the arguments to pass to the constructor of T.
+     * 
+     * @param[in] args The arguments to pass to the constructor of T.
+     * 
+     * @return True if the value was added, false otherwise.
+     */
+    template <typename... Args>
+    bool emplaceFront(Args&&... args) noexcept;
+
     /**
      * @brief Insert value at the back of list.
      *
@@ -232,6 +284,27 @@ public:
      */
     bool pushBack(const T& value) noexcept;
 
+    /**
+     * @brief Move value to the back of list.
+     *
+     * @param[in] value Reference to the value to move.
+     * 
+     * @return True if the value was added, false otherwise.
+     */
+    bool pushBack(T&& value) noexcept;
+
+    /**
+     * @brief Construct value in place at the back of list.
+     *
+     * @tparam Args The type of the arguments to pass to the constructor of T.
+     * 
+     * @param[in] args The arguments to pass to the constructor of T.
+     * 
+     * @return True if the value was added, false otherwise.
+     */
+    template <typename... Args>
+    bool emplaceBack(Args&&... args) noexcept;
+
     /**
      * @brief Insert value at given position in the list.
      *
@@ -261,11 +334,65 @@ public:
      */
     bool remove(Iterator& iterator) noexcept;
 
-protected:
-    /** Node holding data stored in the list. */
-    struct Node;
+    /**
+     * @brief Move all nodes of another list into this list, in front of given position.
+     * 
+     *        The nodes are relinked rather than copied, hence the operation is O(1) and 
+     *        can't fail. The other list is emptied once the operation is completed.
+     *
+     * @param[in] position Iterator pointing at the node to insert in front of, end() to 
+     *                     insert at the back of the list.
+     * @param[in] other    Reference to list holding the nodes to move.
+     */
+    void splice(const Iterator& position, List& other) noexcept;
 
-    bool copy(const List<T>& other) noexcept;
+    /**
+     * @brief Move a single node of another list into this list, in front of given position.
+     * 
+     *        The node is relinked rather than copied, hence the operation is O(1). The other 
+     *        list may be this list, in which case the node is moved within the list.
+     *
+     * @param[in] position Iterator pointing at the node to insert in front of, end() to 
+     *                     insert at the back of the list.
+     * @param[in] other    Reference to list holding the node to move.
+     * @param[in] element  Iterator pointing at the node to move in the other list.
+     * 
+     * @return True if the node was moved, false if the element iterator is invalid.
+     */
+    bool splice(const Iterator& position, List& other, const Iterator& element) noexcept;
+
+    /**
+     * @brief Merge another sorted list into this sorted list.
+     * 
+     *        The nodes are relinked rather than copied, hence no allocations are made. The 
+     *        merge is stable, i.e. equal values of this list precede those of the other list.
+     *        The other list is emptied once the operation is completed.
+     *
+     * @tparam Compare Comparison function object, returning true if the first value 
+     *                 shall precede the second (default = ascending order).
+     * 
+     * @param[in] other   Reference to sorted list holding the nodes to merge.
+     * @param[in] compare The comparison function object.
+     */
+    template <typename Compare = utils::Less<T>>
+    void merge(List& other, const Compare& compare = Compare{}) noexcept;
+
+    /**
+     * @brief Sort the list.
+     * 
+     *        A bottom-up merge sort is used, which relinks the nodes rather than copying 
+     *        the data. The sort is stable, runs in O(n log n) and uses O(1) extra memory.
+     *
+     * @tparam Compare Comparison function object, returning true if the first value 
+     *                 shall precede the second (default = ascending order).
+     * 
+     * @param[in] compare The comparison function object.
+     */
+    template <typename Compare = utils::Less<T>>
+    void sort(const Compare& compare = Compare{}) noexcept;
+
+protected:
+    bool copy(const List& other) noexcept;
 
     template <size_t ValueCount>
     void assign(const T (&values)[ValueCount], const size_t offset = 0U) noexcept;
@@ -275,6 +402,16 @@ protected:
 
     void removeAllNodes() noexcept;
 
+    void release() noexcept;
+
+    void relinkPrevious() noexcept;
+
+    static Node* split(Node* first, const size_t count) noexcept;
+
+    template <typename Compare>
+    static Node* mergeChains(Node* first1, Node* first2, Node*& last, 
+                             const Compare& compare) noexcept;
+
     /** Pointer to the first node of the list. */
     Node* myFirst;
 
@@ -287,4 +424,3 @@ protected:
 } // namespace container
 
 #include "impl/list_impl.h"
-#include "iterator/list_iterator.h"
@@ -0,0 +1,217 @@
+/**
+ * @brief Implementation of binary heap priority queues of any type.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "container/vector.h"
+#include "utils/utils.h"
+
+namespace container
+{
+/**
+ * @brief Position tracker doing nothing, used when the positions of the values aren't needed.
+ */
+struct NoPositionTracker
+{
+    /**
+     * @brief Ignore the new position of given value.
+     *
+     * @tparam T The value type.
+     */
+    template <typename T>
+    constexpr void operator()(const T&, const size_t) const noexcept {}
+};
+
+/**
+ * @brief Class for implementation of binary heap priority queues.
+ *
+ *        The values are kept as a binary heap in given storage, hence push, pop, update and
+ *        remove are O(log n) and the top value is available in O(1). By default, the largest
+ *        value is on top. Use utils::Greater<T> to put the smallest value on top, for instance
+ *        the earliest deadline.
+ *
+ *        The storage can be a growable container::Vector<T> (default) or a fixed-capacity
+ *        container::StaticVector<T, N>, which doesn't use any dynamic memory.
+ *
+ *        The positions of the values change on every push and pop. To update or remove a 
+ *        given value in O(log n), e.g. decrease-key, pass a position tracker. The tracker is 
+ *        called as tracker(value, position) each time a value is placed at a new position, 
+ *        and with position PriorityQueue::Removed when a value leaves the queue. It typically 
+ *        stores the position in a table indexed by an id held by the value:
+ *
+ *            struct Task { uint8_t id; uint16_t deadline; };
+ *            size_t positions[TaskCount]{};
+ *            auto track{[&](const Task& task, size_t position) { positions[task.id] = position; }};
+ *            PriorityQueue<Task, ByDeadline, StaticVector<Task, TaskCount>, decltype(track)> 
+ *                queue{ByDeadline{}, track};
+ *            ...
+ *            queue.update(positions[id], Task{id, newDeadline}); // O(log n).
+ *
+ *        Without a tracker (default), findIf can be used to look up a position in O(n).
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam T The value type.
+ * @tparam Compare Function object returning true if its first argument has lower priority
+ *                 than its second argument (default = utils::Less<T>).
+ * @tparam Storage The container holding the heap (default = container::Vector<T>).
+ * @tparam Tracker Function object notified of the new position of each moved value 
+ *                 (default = container::NoPositionTracker, which does nothing).
+ */
+template <typename T, typename Compare = utils::Less<T>, typename Storage = Vector<T>,
+          typename Tracker = NoPositionTracker>
+class PriorityQueue
+{
+public:
+    /** Position passed to the tracker when a value is removed from the queue. */
+    static constexpr size_t Removed{static_cast<size_t>(-1)};
+
+    /**
+     * @brief Create empty priority queue.
+     *
+     * @param[in] compare The function object used to compare values (default = Compare{}).
+     * @param[in] tracker The function object notified of moved values (default = Tracker{}).
+     */
+    explicit PriorityQueue(const Compare& compare = Compare{}, 
+                           const Tracker& tracker = Tracker{}) noexcept;
+
+    /**
+     * @brief Delete priority queue.
+     */
+    ~PriorityQueue() noexcept = default;
+
+    /**
+     * @brief Get the value at given position in the heap.
+     *
+     * @param[in] index Position of the value. Must be less than the queue size.
+     *
+     * @return Reference to the value at given position.
+     */
+    const T& operator[](const size_t index) const noexcept;
+
+    /**
+     * @brief Get the value with the highest priority.
+     *
+     * @return Pointer to the value with the highest priority, or a nullptr if the queue is empty.
+     */
+    const T* top() const noexcept;
+
+    /**
+     * @brief Get the size of the queue.
+     *
+     * @return The number of values in the queue.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Check if the queue is empty.
+     *
+     * @return True if the queue is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Add value to the queue.
+     *
+     * @param[in] value Reference to the value to add.
+     *
+     * @return True if the value was added, false if the storage is full or out of memory.
+     */
+    bool push(const T& value) noexcept;
+
+    /**
+     * @brief Add value to the queue by moving its resources.
+     *
+     * @param[in] value Reference to the value to add.
+     *
+     * @return True if the value was added, false if the storage is full or out of memory.
+     */
+    bool push(T&& value) noexcept;
+
+    /**
+     * @brief Remove the value with the highest priority.
+     *
+     * @return True if a value was removed, false if the queue is empty.
+     */
+    bool pop() noexcept;
+
+    /**
+     * @brief Remove the value with the highest priority and move it to given variable.
+     *
+     * @param[out] value Reference to variable to store the removed value.
+     *
+     * @return True if a value was removed, false if the queue is empty.
+     */
+    bool pop(T& value) noexcept;
+
+    /**
+     * @brief Replace the value at given position and restore the heap order.
+     *
+     *        Used to change the priority of a queued value, e.g. decrease-key. The operation 
+     *        is O(log n), the position is provided by the tracker (or findIf).
+     *
+     * @param[in] index Position of the value to replace.
+     * @param[in] value Reference to the new value.
+     *
+     * @return True if the value was replaced, false if the index is out of range.
+     */
+    bool update(const size_t index, const T& value) noexcept;
+
+    /**
+     * @brief Remove the value at given position.
+     *
+     *        The operation is O(log n), the position is provided by the tracker (or findIf).
+     *
+     * @param[in] index Position of the value to remove.
+     *
+     * @return True if the value was removed, false if the index is out of range.
+     */
+    bool remove(const size_t index) noexcept;
+
+    /**
+     * @brief Find the position of the first value matching given predicate.
+     *
+     *        Used to look up the position of a value to update or remove when no tracker is 
+     *        used. The search is O(n).
+     *
+     * @tparam Predicate Function object taking a value and returning true on match.
+     *
+     * @param[in] predicate The predicate to match the values against.
+     *
+     * @return The position of the first matching value, or the queue size if none matches.
+     */
+    template <typename Predicate>
+    size_t findIf(const Predicate& predicate) const noexcept;
+
+    /**
+     * @brief Remove all values in the queue.
+     */
+    void clear() noexcept;
+
+    PriorityQueue(const PriorityQueue&)            = delete; // No copy constructor.
+    PriorityQueue(PriorityQueue&&)                 = delete; // No move constructor.
+    PriorityQueue& operator=(const PriorityQueue&) = delete; // No copy assignment.
+    PriorityQueue& operator=(PriorityQueue&&)      = delete; // No move assignment.
+
+private:
+    static size_t parent(const size_t index) noexcept;
+    void siftUp(size_t index) noexcept;
+    void siftDown(size_t index) noexcept;
+    void restore(const size_t index) noexcept;
+    void place(const size_t index, T&& value) noexcept;
+    bool removeUntracked(const size_t index) noexcept;
+
+    /** Storage holding the values as a binary heap. */
+    Storage myData;
+
+    /** Function object used to compare values. */
+    Compare myCompare;
+
+    /** Function object notified of the new position of each moved value. */
+    Tracker myTracker;
+};
+} // namespace container
+
+#include "impl/priority_queue_impl.h"
@@ -0,0 +1,156 @@
+/**
+ * @brief Implementation of static arrays stored in program memory (flash).
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#else
+/** Program memory attribute, data is stored in plain memory on the host. */
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+/**
+ * @brief Program memory reads, which read plain memory on the host. Values may be unaligned.
+ */
+inline uint8_t pgm_read_byte(const void* address) noexcept
+{
+    return *static_cast<const uint8_t*>(address);
+}
+
+inline uint16_t pgm_read_word(const void* address) noexcept
+{
+    uint16_t value;
+    memcpy(&value, address, sizeof(value));
+    return value;
+}
+
+inline uint32_t pgm_read_dword(const void* address) noexcept
+{
+    uint32_t value;
+    memcpy(&value, address, sizeof(value));
+    return value;
+}
+
+inline void* memcpy_P(void* destination, const void* source, const size_t size) noexcept
+{
+    return memcpy(destination, source, size);
+}
+#endif
+
+#include "utils/type_traits.h"
+
+namespace container
+{
+/**
+ * @brief Class for implementation of static arrays stored in program memory.
+ *
+ *        On AVR, constant data is copied from flash to SRAM at startup unless it's placed in
+ *        program memory, which must in turn be read via dedicated instructions. This class
+ *        hides those reads behind the subscript operator and iterators, hence constant tables
+ *        and datasets cost no SRAM. On other targets, the data is read from plain memory.
+ *
+ *        Arrays must be defined as constexpr with the PROGMEM attribute, for instance:
+ *
+ *            constexpr ProgmemArray<uint16_t, 3U> table PROGMEM{{10U, 20U, 30U}};
+ *
+ *        The values are read by copy, hence the array is read-only.
+ *
+ * @tparam T    The array type. Must be trivially copyable.
+ * @tparam Size The array size. Must be greater than 0.
+ */
+template <typename T, size_t Size>
+class ProgmemArray
+{
+    static_assert(Size > 0U, "Array size must be greater than 0!");
+    static_assert(type_traits::is_trivially_copyable<T>::value,
+                  "Program memory array type must be trivially copyable!");
+
+public:
+    /** Constant program memory array iterator. */
+    class ConstIterator;
+
+    /**
+     * @brief Create array containing given values.
+     *
+     * @param[in] values Reference to given values.
+     */
+    explicit constexpr ProgmemArray(const T (&values)[Size]) noexcept;
+
+    /**
+     * @brief Delete array.
+     */
+    ~ProgmemArray() noexcept = default;
+
+    /**
+     * @brief Read element at given index in the array.
+     *
+     * @param[in] index Index of requested element.
+     *
+     * @return Copy of the element at given index.
+     */
+    T operator[](const size_t index) const noexcept;
+
+    /**
+     * @brief Copy elements of the array to given destination in RAM.
+     *
+     * @param[out] destination Pointer to field to store the elements.
+     * @param[in]  offset      Index of the first element to copy (default = 0).
+     * @param[in]  count       The maximum number of elements to copy (default = Size).
+     *
+     * @return The number of copied elements.
+     */
+    size_t copy(T* destination, const size_t offset = 0U, const size_t count = Size) const noexcept;
+
+    /**
+     * @brief Get the address of the data held by the array.
+     *
+     * @note On AVR, this is a program memory address, which can't be dereferenced directly.
+     *
+     * @return Pointer to the data held by the array.
+     */
+    constexpr const T* data() const noexcept { return myData; }
+
+    /**
+     * @brief Get the size of the array.
+     *
+     * @return The size of the array measured in the number of elements it holds.
+     */
+    static constexpr size_t size() noexcept { return Size; }
+
+    /**
+     * @brief Get the beginning of the array.
+     *
+     * @return Iterator pointing at the beginning of the array.
+     */
+    constexpr ConstIterator begin() const noexcept;
+
+    /**
+     * @brief Get the end of the array.
+     *
+     * @return Iterator pointing at the end of the array.
+     */
+    constexpr ConstIterator end() const noexcept;
+
+    /**
+     * @brief Read value stored at given program memory address.
+     *
+     * @param[in] address Program memory address of the value.
+     *
+     * @return Copy of the value.
+     */
+    static T read(const T* address) noexcept;
+
+private:
+    /** Static field holding data, located in program memory. */
+    T myData[Size];
+};
+} // namespace container
+
+#include "impl/progmem_array_impl.h"
+#include "iterator/progmem_array_iterator.h"
@@ -0,0 +1,140 @@
+/**
+ * @brief Implementation of lock-free single-producer/single-consumer ring buffers of any type.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace container
+{
+/**
+ * @brief Class for implementation of lock-free single-producer/single-consumer ring buffers.
+ *
+ *        Intended for passing data between an interrupt service routine and the main loop on
+ *        a single-core MCU: one side only pushes, the other side only pops. Each side only
+ *        writes its own single-byte index, which is read and written atomically, so no
+ *        critical sections are needed.
+ *
+ *        The indexes are free-running, i.e. they are only wrapped when used for indexing,
+ *        which allows all N slots to be used.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam T The buffer type.
+ * @tparam N The capacity of the buffer. Must be a power of two between 1 and 128.
+ */
+template <typename T, size_t N>
+class RingBuffer
+{
+    static_assert((N > 0U) && (N <= 128U), "Ring buffer capacity must be between 1 and 128!");
+    static_assert((N & (N - 1U)) == 0U, "Ring buffer capacity must be a power of two!");
+
+public:
+    /**
+     * @brief Create empty ring buffer.
+     */
+    RingBuffer() noexcept;
+
+    /**
+     * @brief Delete ring buffer.
+     */
+    ~RingBuffer() noexcept = default;
+
+    /**
+     * @brief Push value to the buffer (producer only).
+     *
+     * @param[in] value Reference to the value to push.
+     *
+     * @return True if the value was pushed, false if the buffer is full.
+     */
+    bool push(const T& value) noexcept;
+
+    /**
+     * @brief Push values to the buffer (producer only).
+     *
+     *        As many values as there is room for are pushed.
+     *
+     * @param[in] values Pointer to the values to push.
+     * @param[in] count The number of values to push.
+     *
+     * @return The number of pushed values.
+     */
+    size_t push(const T* values, const size_t count) noexcept;
+
+    /**
+     * @brief Pop the oldest value from the buffer (consumer only).
+     *
+     * @param[out] value Reference to variable to store the popped value.
+     *
+     * @return True if a value was popped, false if the buffer is empty.
+     */
+    bool pop(T& value) noexcept;
+
+    /**
+     * @brief Pop the oldest values from the buffer (consumer only).
+     *
+     *        As many values as available are popped, up to given count.
+     *
+     * @param[out] values Pointer to field to store the popped values.
+     * @param[in] count The maximum number of values to pop.
+     *
+     * @return The number of popped values.
+     */
+    size_t pop(T* values, const size_t count) noexcept;
+
+    /**
+     * @brief Discard all values in the buffer (consumer only).
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Get the number of values in the buffer.
+     *
+     * @return The number of values in the buffer.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Get the capacity of the buffer.
+     *
+     * @return The maximum number of values the buffer can hold.
+     */
+    static constexpr size_t capacity() noexcept { return N; }
+
+    /**
+     * @brief Check if the buffer is empty.
+     *
+     * @return True if the buffer is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Check if the buffer is full.
+     *
+     * @return True if the buffer is full, false otherwise.
+     */
+    bool full() const noexcept;
+
+    RingBuffer(const RingBuffer&)            = delete; // No copy constructor.
+    RingBuffer(RingBuffer&&)                 = delete; // No move constructor.
+    RingBuffer& operator=(const RingBuffer&) = delete; // No copy assignment.
+    RingBuffer& operator=(RingBuffer&&)      = delete; // No move assignment.
+
+private:
+    static constexpr uint8_t Mask{static_cast<uint8_t>(N - 1U)};
+
+    static void barrier() noexcept;
+
+    /** Field holding the values. */
+    T myData[N];
+
+    /** Index of the next slot to write, only written by the producer. */
+    volatile uint8_t myHead;
+
+    /** Index of the next slot to read, only written by the consumer. */
+    volatile uint8_t myTail;
+};
+} // namespace container
+
+#include "impl/ring_buffer_impl.h"
@@ -0,0 +1,357 @@
+/**
+ * @brief Implementation of dynamic vectors with inline storage of any type.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "container/vector.h"
+
+namespace container
+{
+/**
+ * @brief Class for implementation of dynamic vectors with inline storage.
+ *
+ *        Up to N elements are stored inside the vector itself, so no heap allocation is made
+ *        until the vector holds more than N elements. The elements are then moved to the heap.
+ *        The API is the same as for container::Vector.
+ *
+ * @tparam T The vector type.
+ * @tparam N The number of elements stored inline.
+ */
+template <typename T, size_t N>
+class SmallVector
+{
+    static_assert(N > 0U, "The inline capacity of a small vector must exceed 0!");
+
+public:
+    /** Vector iterator. */
+    using Iterator = typename Vector<T>::Iterator;
+
+    /** Constant vector iterator. */
+    using ConstIterator = typename Vector<T>::ConstIterator;
+
+    /**
+     * @brief Create empty vector.
+     */
+    SmallVector() noexcept;
+
+    /**
+     * @brief Create vector of given size.
+     *
+     * @param[in] size The size of vector, i.e. the number of elements it holds.
+     */
+    explicit SmallVector(const size_t size) noexcept;
+
+    /**
+     * @brief Create vector containing given values.
+     *
+     *        Each value is constructed in place.
+     *
+     * @tparam Values Parameter pack containing values.
+     *
+     * @param[in] values The values to add to the vector.
+     */
+    template <typename... Values>
+    explicit SmallVector(const Values&&... values) noexcept;
+
+    /**
+     * @brief Create vector as a copy of another vector.
+     *
+     * @param[in] other Reference to other vector to copy from.
+     */
+    SmallVector(const SmallVector& other) noexcept;
+
+    /**
+     * @brief Move the content from another vector.
+     *
+     *        Heap memory is taken over, inline elements are moved one by one.
+     *        The other vector is emptied once the move operation is completed.
+     *
+     * @param[in] other Reference to other vector to move the content from.
+     */
+    SmallVector(SmallVector&& other) noexcept;
+
+    /**
+     * @brief Delete vector.
+     */
+    ~SmallVector() noexcept;
+
+    /**
+     * @brief Copy the content of vector to assigned vector.
+     *
+     *        Previous values are cleared before copying.
+     *
+     * @param[in] other Reference to vector holding the data to copy.
+     *
+     * @return Reference to this vector.
+     */
+    SmallVector& operator=(const SmallVector& other) noexcept;
+
+    /**
+     * @brief Move the content from other vector.
+     *
+     *        Previous values are cleared before moving.
+     *
+     *        The other vector is emptied once the move operation is completed.
+     *
+     * @param[in] other Reference to vector holding the data to move.
+     *
+     * @return Reference to this vector.
+     */
+    SmallVector& operator=(SmallVector&& other) noexcept;
+
+    /**
+     * @brief Add values from another vector.
+     *
+     * @param[in] other Reference to vector holding the values to add.
+     *
+     * @return Reference to this vector.
+     */
+    SmallVector& operator+=(const SmallVector& other) noexcept;
+
+    /**
+     * @brief Push referenced values to the back of vector.
+     *
+     * @tparam ValueCount The number of values to add.
+     *
+     * @param[in] values Reference to the values to add.
+     *
+     * @return Reference to this vector.
+     */
+    template <size_t ValueCount>
+    SmallVector& operator+=(const T (&values)[ValueCount]) noexcept;
+
+    /**
+     * @brief Get element at given index in the vector.
+     *
+     * @param[in] index Index of requested element.
+     *
+     * @return Reference to the element at given index.
+     */
+    T& operator[](const size_t index) noexcept;
+
+    /**
+     * @brief Get element at given index in the vector.
+     *
+     * @param[in] index Index of requested element.
+     *
+     * @return Reference to the element at given index.
+     */
+    const T& operator[](const size_t index) const noexcept;
+
+    /**
+     * @brief Get the data held by the vector.
+     *
+     * @return Pointer to the beginning of vector.
+     */
+    T* data() noexcept;
+
+    /**
+     * @brief Get the data held by the vector.
+     *
+     * @return Pointer to the beginning of vector.
+     */
+    const T* data() const noexcept;
+
+    /**
+     * @brief Get the size of vector in the number of elements it holds.
+     *
+     * @return The size of vector as an unsigned integer.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Get the capacity of vector, i.e. the number of elements it can hold without
+     *        reallocating.
+     *
+     * @return The capacity of vector as an unsigned integer, which is at least N.
+     */
+    size_t capacity() const noexcept;
+
+    /**
+     * @brief Check if the vector is empty.
+     *
+     * @return True if the vector is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Check if the elements are stored inline, i.e. if no heap memory is used.
+     *
+     * @return True if the elements are stored inline, false otherwise.
+     */
+    bool isInline() const noexcept;
+
+    /**
+     * @brief Get the beginning of vector.
+     *
+     * @return Iterator pointing at the beginning of the vector.
+     */
+    Iterator begin() noexcept;
+
+    /**
+     * @brief Get the beginning of vector.
+     *
+     * @return Iterator pointing at the beginning of the vector.
+     */
+    ConstIterator begin() const noexcept;
+
+    /**
+     * @brief Get the end of vector.
+     *
+     * @return Iterator pointing at the end of the vector.
+     */
+    Iterator end() noexcept;
+
+    /**
+     * @brief Get the end of vector.
+     *
+     * @return Iterator pointing at the end of the vector.
+     */
+    ConstIterator end() const noexcept;
+
+    /**
+     * @brief Get the reverse beginning of the vector.
+     *
+     * @return Iterator pointing at the reverse beginning of the vector.
+     */
+    Iterator rbegin() noexcept;
+
+    /**
+     * @brief Get the reverse beginning of the vector.
+     *
+     * @return Iterator pointing at the reverse beginning of the vector.
+     */
+    ConstIterator rbegin() const noexcept;
+
+    /**
+     * @brief Get the reverse end of the vector.
+     *
+     * @return Iterator pointing at the reverse end of the vector.
+     */
+    Iterator rend() noexcept;
+
+    /**
+     * @brief Get the reverse end of vector.
+     *
+     * @return Iterator pointing at the reverse end of the vector.
+     */
+    ConstIterator rend() const noexcept;
+
+    /**
+     * @brief Get the address of last element of vector.
+     *
+     * @return Pointer to the last element of vector.
+     */
+    T* last() noexcept;
+
+    /**
+     * @brief Get the address of last element of vector.
+     *
+     * @return Pointer to the last element of vector.
+     */
+    const T* last() const noexcept;
+
+    /**
+     * @brief Clear content of vector.
+     *
+     *        The elements are destroyed and heap memory, if any, is released.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Resize the vector to given new size.
+     *
+     *        If the new size exceeds the capacity, the capacity is increased to the larger of
+     *        the new size and twice the current capacity. The capacity is never decreased.
+     *
+     *        New elements are value-initialized, removed elements are destroyed.
+     *
+     * @param[in] newSize The new size of vector.
+     *
+     * @return True if the vector was resized, false otherwise.
+     */
+    bool resize(const size_t newSize) noexcept;
+
+    /**
+     * @brief Reserve memory for given number of elements.
+     *
+     *        The size of the vector is unaffected. Nothing is done if the capacity already
+     *        is sufficient.
+     *
+     * @param[in] capacity The number of elements to reserve memory for.
+     *
+     * @return True if the memory is reserved, false otherwise.
+     */
+    bool reserve(const size_t capacity) noexcept;
+
+    /**
+     * @brief Release unused capacity.
+     *
+     *        The elements are moved back to the inline storage if they fit.
+     *
+     * @return True if the unused capacity was released, false otherwise.
+     */
+    bool shrinkToFit() noexcept;
+
+    /**
+     * @brief Push new value to the back of vector.
+     *
+     * @param[in] value Reference to the new value to push to the vector.
+     *
+     * @return True if the value was pushed to the back of vector, false otherwise.
+     */
+    bool pushBack(const T& value) noexcept;
+
+    /**
+     * @brief Move new value to the back of vector.
+     *
+     * @param[in] value Reference to the new value to move to the vector.
+     *
+     * @return True if the value was pushed to the back of vector, false otherwise.
+     */
+    bool pushBack(T&& value) noexcept;
+
+    /**
+     * @brief Construct new value in place at the back of vector.
+     *
+     * @tparam Args The type of the arguments to pass to the constructor of T.
+     *
+     * @param[in] args The arguments to pass to the constructor of T.
+     *
+     * @return True if the value was added to the back of vector, false otherwise.
+     */
+    template <typename... Args>
+    bool emplaceBack(Args&&... args) noexcept;
+
+    /**
+     * @brief Pop value at the back of vector.
+     *
+     * @return True if the last value of vector was popped, false otherwise.
+     */
+    bool popBack() noexcept;
+
+private:
+    T* inlineData() noexcept;
+    bool addValues(const T* values, const size_t count) noexcept;
+    bool grow(const size_t newSize) noexcept;
+    bool reallocate(const size_t newCapacity) noexcept;
+    void takeOver(SmallVector& other) noexcept;
+
+    /** Pointer to the elements, either the inline storage or a heap allocated field. */
+    T* myData;
+
+    /** The size of the vector in number of elements it holds. */
+    size_t mySize;
+
+    /** The capacity of the vector in number of elements it can hold. */
+    size_t myCapacity;
+
+    /** Inline storage for up to N elements. */
+    alignas(T) uint8_t myStorage[N * sizeof(T)];
+};
+} // namespace container
+
+#include "impl/small_vector_impl.h"
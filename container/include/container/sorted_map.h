@@ -0,0 +1,183 @@
+/**
+ * @brief Implementation of sorted maps of any key and value type.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "container/algorithm.h"
+#include "container/vector.h"
+#include "utils/pair.h"
+#include "utils/utils.h"
+
+namespace container
+{
+/**
+ * @brief Class for implementation of sorted maps.
+ *
+ *        The entries are kept sorted by key in a contiguous vector, hence lookups are 
+ *        O(log n) binary searches over contiguous memory, while insertion and removal are 
+ *        O(n). This suits read-mostly tables such as per-sensor settings and breakpoint 
+ *        tables, where the neighbouring entries of a key are found via lowerBound.
+ *
+ *        The keys are unique. The values can be modified via find, the keys can't.
+ *
+ * @tparam K       The key type.
+ * @tparam V       The value type.
+ * @tparam Compare Function object returning true if its first key precedes its second key
+ *                 (default = utils::Less<K>).
+ */
+template <typename K, typename V, typename Compare = utils::Less<K>>
+class SortedMap
+{
+public:
+    /** Entry holding a key and its associated value. */
+    using Entry = utils::Pair<K, V>;
+
+    /** Constant sorted map iterator. */
+    using ConstIterator = typename Vector<Entry>::ConstIterator;
+
+    /**
+     * @brief Create empty sorted map.
+     *
+     * @param[in] compare The function object used to compare keys (default = Compare{}).
+     */
+    explicit SortedMap(const Compare& compare = Compare{}) noexcept;
+
+    /**
+     * @brief Delete sorted map.
+     */
+    ~SortedMap() noexcept = default;
+
+    /**
+     * @brief Get the entry at given index, the entries being sorted by key.
+     *
+     * @param[in] index Index of the entry. Must be less than the map size.
+     *
+     * @return Reference to the entry at given index.
+     */
+    const Entry& operator[](const size_t index) const noexcept;
+
+    /**
+     * @brief Get the size of the map.
+     *
+     * @return The number of entries in the map.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Check if the map is empty.
+     *
+     * @return True if the map is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Get the beginning of the map.
+     *
+     * @return Iterator pointing at the entry with the first key.
+     */
+    ConstIterator begin() const noexcept;
+
+    /**
+     * @brief Get the end of the map.
+     *
+     * @return Iterator pointing at the end of the map.
+     */
+    ConstIterator end() const noexcept;
+
+    /**
+     * @brief Associate given value with given key. The value of a present key is replaced.
+     *
+     * @param[in] key   Reference to the key.
+     * @param[in] value Reference to the value.
+     *
+     * @return True if the value was stored, false otherwise.
+     */
+    bool insert(const K& key, const V& value) noexcept;
+
+    /**
+     * @brief Remove given key and its associated value.
+     *
+     * @param[in] key Reference to the key.
+     *
+     * @return True if the key was removed, false if it wasn't present.
+     */
+    bool remove(const K& key) noexcept;
+
+    /**
+     * @brief Remove all entries of the map.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Reserve memory for given number of entries.
+     *
+     * @param[in] capacity The number of entries to reserve memory for.
+     *
+     * @return True if the memory was reserved, false otherwise.
+     */
+    bool reserve(const size_t capacity) noexcept;
+
+    /**
+     * @brief Find the value associated with given key.
+     *
+     * @param[in] key Reference to the key.
+     *
+     * @return Pointer to the value, or a nullptr if the key isn't present.
+     */
+    V* find(const K& key) noexcept;
+
+    /**
+     * @brief Find the value associated with given key.
+     *
+     * @param[in] key Reference to the key.
+     *
+     * @return Pointer to the value, or a nullptr if the key isn't present.
+     */
+    const V* find(const K& key) const noexcept;
+
+    /**
+     * @brief Check if given key is present in the map.
+     *
+     * @param[in] key Reference to the key.
+     *
+     * @return True if the key is present, false otherwise.
+     */
+    bool contains(const K& key) const noexcept;
+
+    /**
+     * @brief Get the index of the first entry whose key doesn't precede given key.
+     *
+     * @param[in] key Reference to the key to search for.
+     *
+     * @return The index of the entry, or the map size if none.
+     */
+    size_t lowerBound(const K& key) const noexcept;
+
+    /**
+     * @brief Get the index of the first entry whose key given key precedes.
+     *
+     * @param[in] key Reference to the key to search for.
+     *
+     * @return The index of the entry, or the map size if none.
+     */
+    size_t upperBound(const K& key) const noexcept;
+
+    SortedMap(const SortedMap&)            = delete; // No copy constructor.
+    SortedMap(SortedMap&&)                 = delete; // No move constructor.
+    SortedMap& operator=(const SortedMap&) = delete; // No copy assignment.
+    SortedMap& operator=(SortedMap&&)      = delete; // No move assignment.
+
+private:
+    size_t findIndex(const K& key) const noexcept;
+
+    /** Vector holding the entries sorted by key. */
+    Vector<Entry> myData;
+
+    /** The function object used to compare keys. */
+    Compare myCompare;
+};
+} // namespace container
+
+#include "impl/sorted_map_impl.h"
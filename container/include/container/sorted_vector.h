@@ -0,0 +1,187 @@
+/**
+ * @brief Implementation of sorted vectors of any type.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "container/algorithm.h"
+#include "container/span.h"
+#include "container/vector.h"
+#include "utils/utils.h"
+
+namespace container
+{
+/**
+ * @brief Class for implementation of sorted vectors.
+ *
+ *        The values are kept sorted in a contiguous vector, hence lookups are O(log n) binary
+ *        searches over contiguous memory, while insertion and removal are O(n). This suits
+ *        read-mostly data such as calibration points and thresholds. Equal values are kept in
+ *        insertion order.
+ *
+ *        The values can only be read, since modifying them in place could break the order.
+ *
+ * @tparam T       The value type.
+ * @tparam Compare Function object returning true if its first argument precedes its second
+ *                 argument (default = utils::Less<T>).
+ */
+template <typename T, typename Compare = utils::Less<T>>
+class SortedVector
+{
+public:
+    /** Constant sorted vector iterator. */
+    using ConstIterator = typename Vector<T>::ConstIterator;
+
+    /**
+     * @brief Create empty sorted vector.
+     *
+     * @param[in] compare The function object used to compare values (default = Compare{}).
+     */
+    explicit SortedVector(const Compare& compare = Compare{}) noexcept;
+
+    /**
+     * @brief Delete sorted vector.
+     */
+    ~SortedVector() noexcept = default;
+
+    /**
+     * @brief Get the value at given index.
+     *
+     * @param[in] index Index of the value. Must be less than the vector size.
+     *
+     * @return Reference to the value at given index.
+     */
+    const T& operator[](const size_t index) const noexcept;
+
+    /**
+     * @brief Get the data held by the vector.
+     *
+     * @return Pointer to the first value, in sorted order.
+     */
+    const T* data() const noexcept;
+
+    /**
+     * @brief Get the size of the vector.
+     *
+     * @return The number of values in the vector.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Check if the vector is empty.
+     *
+     * @return True if the vector is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Get the beginning of the vector.
+     *
+     * @return Iterator pointing at the beginning of the vector.
+     */
+    ConstIterator begin() const noexcept;
+
+    /**
+     * @brief Get the end of the vector.
+     *
+     * @return Iterator pointing at the end of the vector.
+     */
+    ConstIterator end() const noexcept;
+
+    /**
+     * @brief Replace the content of the vector with given values.
+     *
+     *        The values don't need to be sorted, but sorted values are added in O(n).
+     *
+     * @param[in] values The values to add.
+     *
+     * @return True if the values were added, false otherwise.
+     */
+    bool assign(Span<const T> values) noexcept;
+
+    /**
+     * @brief Insert given value at its sorted position, after any equal values.
+     *
+     * @param[in] value Reference to the value to insert.
+     *
+     * @return True if the value was inserted, false otherwise.
+     */
+    bool insert(const T& value) noexcept;
+
+    /**
+     * @brief Remove the first value equal to given value.
+     *
+     * @param[in] value Reference to the value to remove.
+     *
+     * @return True if a value was removed, false if no equal value was found.
+     */
+    bool remove(const T& value) noexcept;
+
+    /**
+     * @brief Remove all values of the vector.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Reserve memory for given number of values.
+     *
+     * @param[in] capacity The number of values to reserve memory for.
+     *
+     * @return True if the memory was reserved, false otherwise.
+     */
+    bool reserve(const size_t capacity) noexcept;
+
+    /**
+     * @brief Find the first value equal to given value.
+     *
+     * @param[in] value Reference to the value to search for.
+     *
+     * @return Pointer to the value, or a nullptr if no equal value was found.
+     */
+    const T* find(const T& value) const noexcept;
+
+    /**
+     * @brief Check if the vector holds a value equal to given value.
+     *
+     * @param[in] value Reference to the value to search for.
+     *
+     * @return True if an equal value was found, false otherwise.
+     */
+    bool contains(const T& value) const noexcept;
+
+    /**
+     * @brief Get the index of the first value that doesn't precede given value.
+     *
+     * @param[in] value Reference to the value to search for.
+     *
+     * @return The index of the value, or the vector size if none.
+     */
+    size_t lowerBound(const T& value) const noexcept;
+
+    /**
+     * @brief Get the index of the first value that given value precedes.
+     *
+     * @param[in] value Reference to the value to search for.
+     *
+     * @return The index of the value, or the vector size if none.
+     */
+    size_t upperBound(const T& value) const noexcept;
+
+    SortedVector(const SortedVector&)            = delete; // No copy constructor.
+    SortedVector(SortedVector&&)                 = delete; // No move constructor.
+    SortedVector& operator=(const SortedVector&) = delete; // No copy assignment.
+    SortedVector& operator=(SortedVector&&)      = delete; // No move assignment.
+
+private:
+    bool isEqual(const T& x, const T& y) const noexcept;
+
+    /** Vector holding the values in sorted order. */
+    Vector<T> myData;
+
+    /** The function object used to compare values. */
+    Compare myCompare;
+};
+} // namespace container
+
+#include "impl/sorted_vector_impl.h"
@@ -0,0 +1,239 @@
+/**
+ * @brief Implementation of non-owning views of contiguous sequences of any type.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "utils/type_traits.h"
+
+namespace container
+{
+template <typename T, size_t Size>
+class Array;
+
+template <typename T>
+class Vector;
+
+template <typename T, size_t N>
+class StaticVector;
+
+template <typename T, size_t N>
+class SmallVector;
+
+/**
+ * @brief Class for implementation of non-owning views of contiguous sequences.
+ *
+ *        A span holds a pointer and a size only, hence it's cheap to pass by value. It can be
+ *        created implicitly from C arrays, arrays, vectors, static vectors and small vectors,
+ *        which lets functions accept any of them without copying the data.
+ *
+ *        The viewed data must outlive the span. Use Span<const T> for read-only views, which
+ *        are the only spans that can view const containers.
+ *
+ * @tparam T The element type, const qualified for read-only views.
+ */
+template <typename T>
+class Span
+{
+public:
+    /** The element type without const qualification. */
+    using ValueType = typename type_traits::remove_const<T>::type;
+
+    /** Span iterator. */
+    using Iterator = T*;
+
+    /**
+     * @brief Create empty span.
+     */
+    constexpr Span() noexcept;
+
+    /**
+     * @brief Create span viewing given data.
+     *
+     * @param[in] data Pointer to the first element.
+     * @param[in] size The number of elements.
+     */
+    constexpr Span(T* data, const size_t size) noexcept;
+
+    /**
+     * @brief Create span viewing given C array.
+     *
+     * @tparam Size The array size.
+     *
+     * @param[in] values Reference to the array.
+     */
+    template <size_t Size>
+    constexpr Span(T (&values)[Size]) noexcept;
+
+    /**
+     * @brief Create span viewing given array.
+     *
+     * @tparam Size The array size.
+     *
+     * @param[in] array Reference to the array.
+     */
+    template <size_t Size>
+    constexpr Span(Array<ValueType, Size>& array) noexcept;
+
+    /**
+     * @brief Create read-only span viewing given array.
+     *
+     * @tparam Size The array size.
+     *
+     * @param[in] array Reference to the array.
+     */
+    template <size_t Size>
+    constexpr Span(const Array<ValueType, Size>& array) noexcept;
+
+    /**
+     * @brief Create span viewing given vector.
+     *
+     * @param[in] vector Reference to the vector.
+     */
+    Span(Vector<ValueType>& vector) noexcept;
+
+    /**
+     * @brief Create read-only span viewing given vector.
+     *
+     * @param[in] vector Reference to the vector.
+     */
+    Span(const Vector<ValueType>& vector) noexcept;
+
+    /**
+     * @brief Create span viewing given static vector.
+     *
+     * @tparam N The capacity of the vector.
+     *
+     * @param[in] vector Reference to the vector.
+     */
+    template <size_t N>
+    Span(StaticVector<ValueType, N>& vector) noexcept;
+
+    /**
+     * @brief Create read-only span viewing given static vector.
+     *
+     * @tparam N The capacity of the vector.
+     *
+     * @param[in] vector Reference to the vector.
+     */
+    template <size_t N>
+    Span(const StaticVector<ValueType, N>& vector) noexcept;
+
+    /**
+     * @brief Create span viewing given small vector.
+     *
+     * @tparam N The inline capacity of the vector.
+     *
+     * @param[in] vector Reference to the vector.
+     */
+    template <size_t N>
+    Span(SmallVector<ValueType, N>& vector) noexcept;
+
+    /**
+     * @brief Create read-only span viewing given small vector.
+     *
+     * @tparam N The inline capacity of the vector.
+     *
+     * @param[in] vector Reference to the vector.
+     */
+    template <size_t N>
+    Span(const SmallVector<ValueType, N>& vector) noexcept;
+
+    /**
+     * @brief Create span viewing the same data as another span, e.g. a read-only view of a
+     *        mutable span.
+     *
+     * @param[in] other Reference to the other span.
+     */
+    constexpr Span(const Span<ValueType>& other) noexcept;
+
+    /**
+     * @brief Delete span. The viewed data is left untouched.
+     */
+    ~Span() noexcept = default;
+
+    /**
+     * @brief Get element at given index in the span.
+     *
+     * @param[in] index Index of requested element.
+     *
+     * @return Reference to the element at given index.
+     */
+    constexpr T& operator[](const size_t index) const noexcept;
+
+    /**
+     * @brief Get the data viewed by the span.
+     *
+     * @return Pointer to the first element.
+     */
+    constexpr T* data() const noexcept;
+
+    /**
+     * @brief Get the size of the span.
+     *
+     * @return The number of elements in the span.
+     */
+    constexpr size_t size() const noexcept;
+
+    /**
+     * @brief Check if the span is empty.
+     *
+     * @return True if the span is empty, false otherwise.
+     */
+    constexpr bool empty() const noexcept;
+
+    /**
+     * @brief Get the beginning of the span.
+     *
+     * @return Iterator pointing at the beginning of the span.
+     */
+    constexpr Iterator begin() const noexcept;
+
+    /**
+     * @brief Get the end of the span.
+     *
+     * @return Iterator pointing at the end of the span.
+     */
+    constexpr Iterator end() const noexcept;
+
+    /**
+     * @brief Get a span viewing part of this span.
+     *
+     *        The part is truncated to fit within this span.
+     *
+     * @param[in] offset Index of the first element of the part.
+     * @param[in] count  The maximum number of elements of the part (default = all remaining).
+     *
+     * @return Span viewing the part.
+     */
+    constexpr Span subspan(const size_t offset, const size_t count = static_cast<size_t>(-1)) const noexcept;
+
+    /**
+     * @brief Get a span viewing the first elements of this span.
+     *
+     * @param[in] count The maximum number of elements to view.
+     *
+     * @return Span viewing the first elements.
+     */
+    constexpr Span first(const size_t count) const noexcept;
+
+    /**
+     * @brief Get a span viewing the last elements of this span.
+     *
+     * @param[in] count The maximum number of elements to view.
+     *
+     * @return Span viewing the last elements.
+     */
+    constexpr Span last(const size_t count) const noexcept;
+
+private:
+    /** Pointer to the first element. */
+    T* myData;
+
+    /** The number of elements. */
+    size_t mySize;
+};
+} // namespace container
+
+#include "impl/span_impl.h"
@@ -0,0 +1,163 @@
+/**
+ * @brief Implementation of sliding windows with running statistics for sensor time series.
+ */
+#pragma once
+
+#include <stddef.h>
+
+namespace container
+{
+/**
+ * @brief Class for implementation of sliding windows with running statistics.
+ *
+ *        The window holds the last N samples in a ring. The sum and sum of squares are updated
+ *        incrementally, which makes the mean and variance O(1). To keep the rounding errors 
+ *        of the running sums bounded in long-running loops (double is 32-bit on AVR), both 
+ *        sums are recomputed from the ring each time it wraps, i.e. O(N) once per N pushes. 
+ *        The sums are taken relative to the window mean at the last recomputation, which 
+ *        avoids cancellation in the variance when the mean is large compared to the spread.
+ *        The minimum and maximum are tracked by monotonic deques, which makes them O(1) 
+ *        amortized per pushed sample.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam T The sample type.
+ * @tparam N The number of samples in the window.
+ */
+template <typename T, size_t N>
+class StatWindow
+{
+    static_assert(N > 0U, "Stat window size must exceed 0!");
+
+public:
+    /**
+     * @brief Create empty window.
+     */
+    StatWindow() noexcept;
+
+    /**
+     * @brief Delete window.
+     */
+    ~StatWindow() noexcept = default;
+
+    /**
+     * @brief Push sample to the window. The oldest sample is discarded if the window is full.
+     *
+     * @param[in] sample The sample to push.
+     */
+    void push(const T& sample) noexcept;
+
+    /**
+     * @brief Discard all samples in the window.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Get the number of samples in the window.
+     *
+     * @return The number of samples in the window.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Get the capacity of the window.
+     *
+     * @return The maximum number of samples the window can hold.
+     */
+    static constexpr size_t capacity() noexcept { return N; }
+
+    /**
+     * @brief Check if the window is empty.
+     *
+     * @return True if the window is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Check if the window is full.
+     *
+     * @return True if the window is full, false otherwise.
+     */
+    bool full() const noexcept;
+
+    /**
+     * @brief Get the most recent sample.
+     *
+     * @return The most recent sample, or T{} if the window is empty.
+     */
+    T latest() const noexcept;
+
+    /**
+     * @brief Get the mean of the samples in the window.
+     *
+     * @return The mean, or 0 if the window is empty.
+     */
+    double mean() const noexcept;
+
+    /**
+     * @brief Get the (population) variance of the samples in the window.
+     *
+     * @return The variance, or 0 if the window is empty.
+     */
+    double variance() const noexcept;
+
+    /**
+     * @brief Get the smallest sample in the window.
+     *
+     * @return The smallest sample, or T{} if the window is empty.
+     */
+    T min() const noexcept;
+
+    /**
+     * @brief Get the largest sample in the window.
+     *
+     * @return The largest sample, or T{} if the window is empty.
+     */
+    T max() const noexcept;
+
+    StatWindow(const StatWindow&)            = delete; // No copy constructor.
+    StatWindow(StatWindow&&)                 = delete; // No move constructor.
+    StatWindow& operator=(const StatWindow&) = delete; // No copy assignment.
+    StatWindow& operator=(StatWindow&&)      = delete; // No move assignment.
+
+private:
+    /** Monotonic deque holding the slots of candidate extremes, oldest first. */
+    struct Deque
+    {
+        size_t slots[N]; // Slots of the samples in the deque.
+        size_t first;    // Index of the oldest slot.
+        size_t count;    // The number of slots in the deque.
+    };
+
+    static size_t wrap(const size_t index) noexcept;
+    void evict(Deque& deque, const size_t slot) noexcept;
+    void insert(Deque& deque, const size_t slot, const bool keepMin) noexcept;
+    void recomputeSums() noexcept;
+
+    /** Ring holding the samples. */
+    T myData[N];
+
+    /** Slot of the next sample to write. */
+    size_t myHead;
+
+    /** The number of samples in the window. */
+    size_t mySize;
+
+    /** Offset subtracted from each sample before it's added to the sums. */
+    double myOffset;
+
+    /** Sum of the offset samples in the window. */
+    double mySum;
+
+    /** Sum of the squared offset samples in the window. */
+    double mySumOfSquares;
+
+    /** Deque with increasing samples, the front holds the minimum. */
+    Deque myMinDeque;
+
+    /** Deque with decreasing samples, the front holds the maximum. */
+    Deque myMaxDeque;
+};
+} // namespace container
+
+#include "impl/stat_window_impl.h"
@@ -0,0 +1,223 @@
+/**
+ * @brief Implementation of fixed-capacity vectors of any type.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "container/array.h"
+
+namespace container
+{
+/**
+ * @brief Class for implementation of fixed-capacity vectors.
+ *
+ *        The elements are stored in a static array, so no dynamic memory is ever allocated
+ *        and the memory usage is known at link time. The size varies between 0 and N.
+ *
+ * @tparam T The vector type.
+ * @tparam N The capacity of the vector. Must be greater than 0.
+ */
+template <typename T, size_t N>
+class StaticVector
+{
+public:
+    /** Vector iterator. */
+    using Iterator = typename Array<T, N>::Iterator;
+
+    /** Constant vector iterator. */
+    using ConstIterator = typename Array<T, N>::ConstIterator;
+
+    /**
+     * @brief Create empty vector.
+     */
+    StaticVector() noexcept;
+
+    /**
+     * @brief Create vector containing given values.
+     *
+     *        Values exceeding the capacity are ignored.
+     *
+     * @tparam Values Parameter pack containing values.
+     *
+     * @param[in] values The values to add to the vector.
+     */
+    template <typename... Values>
+    explicit StaticVector(const Values&&... values) noexcept;
+
+    /**
+     * @brief Create vector as a copy of another vector.
+     *
+     * @param[in] other Reference to other vector to copy from.
+     */
+    StaticVector(const StaticVector& other) noexcept;
+
+    /**
+     * @brief Delete vector.
+     */
+    ~StaticVector() noexcept = default;
+
+    /**
+     * @brief Copy the content of vector to assigned vector.
+     *
+     *        Previous values are cleared before copying.
+     *
+     * @param[in] other Reference to vector holding the data to copy.
+     *
+     * @return Reference to this vector.
+     */
+    StaticVector& operator=(const StaticVector& other) noexcept;
+
+    /**
+     * @brief Get element at given index in the vector.
+     *
+     * @param[in] index Index of requested element.
+     *
+     * @return Reference to the element at given index.
+     */
+    T& operator[](const size_t index) noexcept;
+
+    /**
+     * @brief Get element at given index in the vector.
+     *
+     * @param[in] index Index of requested element.
+     *
+     * @return Reference to the element at given index.
+     */
+    const T& operator[](const size_t index) const noexcept;
+
+    /**
+     * @brief Get the data held by the vector.
+     *
+     * @return Pointer to the beginning of vector.
+     */
+    T* data() noexcept;
+
+    /**
+     * @brief Get the data held by the vector.
+     *
+     * @return Pointer to the beginning of vector.
+     */
+    const T* data() const noexcept;
+
+    /**
+     * @brief Get the size of vector in the number of elements it holds.
+     *
+     * @return The size of vector as an unsigned integer.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Get the capacity of vector, i.e. the maximum number of elements it can hold.
+     *
+     * @return The capacity of vector as an unsigned integer.
+     */
+    static constexpr size_t capacity() noexcept { return N; }
+
+    /**
+     * @brief Check if the vector is empty.
+     *
+     * @return True if the vector is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Check if the vector is full.
+     *
+     * @return True if the vector is full, false otherwise.
+     */
+    bool full() const noexcept;
+
+    /**
+     * @brief Get the beginning of vector.
+     *
+     * @return Iterator pointing at the beginning of the vector.
+     */
+    Iterator begin() noexcept;
+
+    /**
+     * @brief Get the beginning of vector.
+     *
+     * @return Iterator pointing at the beginning of the vector.
+     */
+    ConstIterator begin() const noexcept;
+
+    /**
+     * @brief Get the end of vector.
+     *
+     * @return Iterator pointing at the end of the vector.
+     */
+    Iterator end() noexcept;
+
+    /**
+     * @brief Get the end of vector.
+     *
+     * @return Iterator pointing at the end of the vector.
+     */
+    ConstIterator end() const noexcept;
+
+    /**
+     * @brief Get the address of last element of vector.
+     *
+     * @return Pointer to the last element of vector, or a nullptr if the vector is empty.
+     */
+    T* last() noexcept;
+
+    /**
+     * @brief Get the address of last element of vector.
+     *
+     * @return Pointer to the last element of vector, or a nullptr if the vector is empty.
+     */
+    const T* last() const noexcept;
+
+    /**
+     * @brief Clear content of vector.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Resize the vector to given new size.
+     *
+     *        New elements are value-initialized.
+     *
+     * @param[in] newSize The new size of vector.
+     *
+     * @return True if the vector was resized, false if the new size exceeds the capacity.
+     */
+    bool resize(const size_t newSize) noexcept;
+
+    /**
+     * @brief Push new value to the back of vector.
+     *
+     * @param[in] value Reference to the new value to push to the vector.
+     *
+     * @return True if the value was pushed to the back of vector, false if the vector is full.
+     */
+    bool pushBack(const T& value) noexcept;
+
+    /**
+     * @brief Move new value to the back of vector.
+     *
+     * @param[in] value Reference to the new value to move to the vector.
+     *
+     * @return True if the value was pushed to the back of vector, false if the vector is full.
+     */
+    bool pushBack(T&& value) noexcept;
+
+    /**
+     * @brief Pop value at the back of vector.
+     *
+     * @return True if the last value of vector was popped, false if the vector is empty.
+     */
+    bool popBack() noexcept;
+
+private:
+    /** Static array holding the elements. */
+    Array<T, N> myData;
+
+    /** The size of the vector in number of elements it holds. */
+    size_t mySize;
+};
+} // namespace container
+
+#include "impl/static_vector_impl.h"
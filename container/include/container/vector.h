@@ -33,6 +33,8 @@ public:
 
     /**
      * @brief Create vector containing given values.
+     * 
+     *        The memory is allocated once and each value is constructed in place.
      *
      * @tparam Values Parameter pack containing values.
      * 
@@ -139,6 +141,13 @@ public:
      */
     const T& operator[](const size_t index) const noexcept;
 
+    /**
+     * @brief Get the data held by the vector.
+     *
+     * @return Pointer to the beginning of vector.
+     */
+    T* data() noexcept;
+
     /**
      * @brief Get the data held by the vector.
      *
@@ -147,12 +156,20 @@ public:
     const T* data() const noexcept;
 
     /**
-     * @brief Get the size of vector in the number of elements it can hold.
+     * @brief Get the size of vector in the number of elements it holds.
      *
      * @return The size of vector as an unsigned integer.
      */
     size_t size() const noexcept;
 
+    /**
+     * @brief Get the capacity of vector, i.e. the number of elements it can hold without
+     *        reallocating.
+     *
+     * @return The capacity of vector as an unsigned integer.
+     */
+    size_t capacity() const noexcept;
+
     /**
      * @brief Check if the vector is empty.
      *
@@ -232,11 +249,18 @@ public:
 
     /**
      * @brief Clear content of vector.
+     * 
+     *        The elements are destroyed and the memory is released.
      */
     void clear() noexcept;
 
     /**
      * @brief Resize the vector to given new size.
+     * 
+     *        If the new size exceeds the capacity, the capacity is increased to the larger of
+     *        the new size and twice the current capacity. The capacity is never decreased.
+     * 
+     *        New elements are value-initialized, removed elements are destroyed.
      *
      * @param[in] newSize The new size of vector.
      * 
@@ -244,6 +268,26 @@ public:
      */
     bool resize(const size_t newSize) noexcept;
 
+    /**
+     * @brief Reserve memory for given number of elements.
+     * 
+     *        The size of the vector is unaffected. Nothing is done if the capacity already 
+     *        is sufficient. Trivially copyable elements are reallocated in place if possible, 
+     *        other elements are moved to the new memory.
+     *
+     * @param[in] capacity The number of elements to reserve memory for.
+     * 
+     * @return True if the memory is reserved, false otherwise.
+     */
+    bool reserve(const size_t capacity) noexcept;
+
+    /**
+     * @brief Release unused capacity, i.e. reduce the capacity to the size of the vector.
+     * 
+     * @return True if the unused capacity was released, false otherwise.
+     */
+    bool shrinkToFit() noexcept;
+
     /**
      * @brief Push new value to the back of vector.
      *
@@ -253,31 +297,152 @@ public:
      */
     bool pushBack(const T& value) noexcept;
 
+    /**
+     * @brief Move new value to the back of vector.
+     *
+     * @param[in] value Reference to the new value to move to the vector.
+     * 
+     * @return True if the value was pushed to the back of vector, false otherwise.
+     */
+    bool pushBack(T&& value) noexcept;
+
+    /**
+     * @brief Construct new value in place at the back of vector.
+     *
+     * @tparam Args The type of the arguments to pass to the constructor of T.
+     * 
+     * @param[in] args The arguments to pass to the constructor of T.
+     * 
+     * @return True if the value was added to the back of vector, false otherwise.
+     */
+    template <typename... Args>
+    bool emplaceBack(Args&&... args) noexcept;
+
     /** 
-     * @brief Pop value at the back of vector noexcept.
+     * @brief Pop value at the back of vector.
+     * 
+     *        The capacity is kept, use shrinkToFit to release unused memory.
      *
      * @return True if the last value of vector was popped, false otherwise.
      */
-    bool popBack();
+    bool popBack() noexcept;
 
-protected:
+    /**
+     * @brief Insert value at given position in the vector.
+     *
+     *        The subsequent elements are shifted one step towards the back.
+     *
+     * @param[in] index The position of the new value. Must not exceed the vector size.
+     * @param[in] value Reference to the value to insert.
+     * 
+     * @return True if the value was inserted, false otherwise.
+     */
+    bool insert(const size_t index, const T& value) noexcept;
 
-    bool copy(const Vector<T>& other) noexcept;
-    void assign(const Vector<T>& other, const size_t offset = 0) noexcept;
+    /**
+     * @brief Move value to given position in the vector.
+     *
+     *        The subsequent elements are shifted one step towards the back.
+     *
+     * @param[in] index The position of the new value. Must not exceed the vector size.
+     * @param[in] value Reference to the value to move into the vector.
+     * 
+     * @return True if the value was inserted, false otherwise.
+     */
+    bool insert(const size_t index, T&& value) noexcept;
 
-    template <size_t ValueCount>
-    void assign(const T (&values)[ValueCount], const size_t offset = 0) noexcept;
+    /**
+     * @brief Insert range of values at given position in the vector.
+     *
+     *        The subsequent elements are shifted towards the back in a single pass, and the 
+     *        vector is reallocated at most once.
+     *
+     * @param[in] index The position of the first new value. Must not exceed the vector size.
+     * @param[in] first Pointer to the first value to insert.
+     * @param[in] last  Pointer to the position after the last value to insert.
+     * 
+     * @return True if the values were inserted, false otherwise.
+     */
+    bool insert(const size_t index, const T* first, const T* last) noexcept;
 
+    /**
+     * @brief Construct new value in place at given position in the vector.
+     *
+     *        The subsequent elements are shifted one step towards the back.
+     *
+     * @tparam Args The type of the arguments to pass to the constructor of T.
+     * 
+     * @param[in] index The position of the new value. Must not exceed the vector size.
+     * @param[in] args  The arguments to pass to the constructor of T.
+     * 
+     * @return True if the value was inserted, false otherwise.
+     */
+    template <typename... Args>
+    bool emplace(const size_t index, Args&&... args) noexcept;
+
+    /**
+     * @brief Erase value at given position in the vector.
+     *
+     *        The subsequent elements are shifted one step towards the front. The capacity is kept.
+     *
+     * @param[in] index The position of the value to erase.
+     * 
+     * @return True if the value was erased, false if the index is out of range.
+     */
+    bool erase(const size_t index) noexcept;
+
+    /**
+     * @brief Erase range of values in the vector.
+     *
+     *        The subsequent elements are shifted towards the front in a single pass. The capacity
+     *        is kept.
+     *
+     * @param[in] first The position of the first value to erase.
+     * @param[in] last  The position after the last value to erase.
+     * 
+     * @return True if the values were erased, false if the range is invalid.
+     */
+    bool erase(const size_t first, const size_t last) noexcept;
+
+    /**
+     * @brief Erase all values matching given predicate.
+     *
+     *        The remaining values keep their order and are compacted in a single pass, hence
+     *        the operation is O(n). The capacity is kept.
+     *
+     * @tparam Predicate Function object taking a value and returning true if it's to be erased.
+     * 
+     * @param[in] predicate The predicate to match the values against.
+     * 
+     * @return The number of erased values.
+     */
+    template <typename Predicate>
+    size_t eraseIf(const Predicate& predicate) noexcept;
+
+protected:
+
+    bool copy(const Vector<T>& other) noexcept;
+    void assign(const T* values, const size_t count) noexcept;
     bool addValues(const Vector<T>& other) noexcept;
 
     template <size_t ValueCount>
     bool addValues(const T (&values)[ValueCount]) noexcept;
 
+    bool grow(const size_t newSize) noexcept;
+    bool reallocate(const size_t newCapacity) noexcept;
+    bool openGap(const size_t index, const size_t count) noexcept;
+
+    template <typename Value>
+    void fillGap(const size_t index, const size_t oldSize, Value&& value) noexcept;
+
     /** Pointer to dynamic field holding data. */
     T* myData;
 
-    /** The size of the field in number of elements it can hold. */
+    /** The size of the vector in number of elements it holds. */
     size_t mySize;
+
+    /** The capacity of the field in number of elements it can hold. */
+    size_t myCapacity;
 };
 } // namespace container
 
@@ -3,8 +3,9 @@
  */
 #include <avr/interrupt.h>
 
+#include "container/bitset.h"
+#include "container/flat_map.h"
 #include "driver/atmega328p/gpio.h"
-#include "utils/callback_array.h"
 #include "utils/utils.h"
 
 namespace driver 
@@ -13,16 +14,6 @@ namespace atmega328p
 {
 namespace
 {
-/**
- * @brief Structure of indexes for callbacks associated with the I/O ports.
- */
-struct CallbackIndex
-{
-    static constexpr uint8_t PortB{0U}; // Index for callback associated with I/O port B.
-    static constexpr uint8_t PortC{1U}; // Index for callback associated with I/O port C.
-    static constexpr uint8_t PortD{2U}; // Index for callback associated with I/O port D.
-};
-
 /**
  * @brief Structure of pin offsets, i.e. the discrepancy between the Arduino and the ATmega328p
  *        pin numbers, for each I/O port.
@@ -45,18 +36,18 @@ struct GpioParam
     /** The number of available GPIO pins. */
     static constexpr uint8_t PinCount{20U};
 
-    /** Pointers to callbacks. */
-    static container::CallbackArray<IoPortCount> callbacks;
+    /** Pointers to callbacks, associated with their I/O port. */
+    static container::FlatMap<Gpio::IoPort, void (*)(), IoPortCount> callbacks;
 
     /** Pin registry (1 = reserved, 0 = free). */
-    static uint32_t pinRegistry;
+    static container::Bitset<PinCount> pinRegistry;
 };
 
-/** Pointers to callbacks. */
-container::CallbackArray<GpioParam::IoPortCount> GpioParam::callbacks{};
+/** Pointers to callbacks, associated with their I/O port. */
+container::FlatMap<Gpio::IoPort, void (*)(), GpioParam::IoPortCount> GpioParam::callbacks{};
 
 /** Pin registry (1 = reserved, 0 = free). */
-uint32_t GpioParam::pinRegistry{};
+container::Bitset<GpioParam::PinCount> GpioParam::pinRegistry{};
 
 // -----------------------------------------------------------------------------
 constexpr bool isPinNumberValid(const uint8_t pin) noexcept { return GpioParam::PinCount > pin; }
@@ -64,7 +55,7 @@ constexpr bool isPinNumberValid(const uint8_t pin) noexcept { return GpioParam::
 // -----------------------------------------------------------------------------
 constexpr bool isPinReserved(const uint8_t pin) noexcept
 {
-    return isPinNumberValid(pin) ? utils::read(GpioParam::pinRegistry, pin) : false;
+    return GpioParam::pinRegistry.test(pin);
 }
 
 // -----------------------------------------------------------------------------
@@ -94,6 +85,14 @@ constexpr uint8_t getPhysicalPin(const uint8_t pin) noexcept
     else                                 { return static_cast<uint8_t>(-1); }  
 }
 
+// -----------------------------------------------------------------------------
+constexpr uint8_t getPinNumber(const Gpio::IoPort port, const uint8_t physicalPin) noexcept
+{
+    if (port == Gpio::IoPort::B)      { return physicalPin + PinOffset::PortB; }
+    else if (port == Gpio::IoPort::C) { return physicalPin + PinOffset::PortC; }
+    else                              { return physicalPin + PinOffset::PortD; }
+}
+
 // -----------------------------------------------------------------------------
 constexpr bool isDirectionValid(const Gpio::Direction direction) noexcept
 {
@@ -101,9 +100,11 @@ constexpr bool isDirectionValid(const Gpio::Direction direction) noexcept
 }
 
 // -----------------------------------------------------------------------------
-inline void invokeCallback(const uint8_t port) noexcept
+inline void invokeCallback(const Gpio::IoPort port) noexcept
 {
-    GpioParam::callbacks.invoke(port);
+    // The I/O ports are used as hash, hence the lookup never probes more than one slot.
+    const auto callback{GpioParam::callbacks.find(port)};
+    if ((callback != nullptr) && (*callback != nullptr)) { (*callback)(); }
 }
 } // namespace
 
@@ -183,7 +184,7 @@ Gpio::~Gpio() noexcept
     // Free resources used for the GPIO before deletion.
     utils::clear(myHardware->dirReg, myPin);
     utils::clear(myHardware->portReg, myPin);
-    utils::clear(GpioParam::pinRegistry, myPin);
+    GpioParam::pinRegistry.reset(getPinNumber(myHardware->port, myPin));
 
     enableInterrupt(false);
     myHardware = nullptr; 
@@ -254,7 +255,7 @@ Gpio::Hardware* Gpio::reserve(const uint8_t pin, const Direction direction) noex
 
     // Initialize the hardware, register the given pin on success.
     auto hardware{initHardware(pin)};
-    if (hardware) { utils::set(GpioParam::pinRegistry, pin); }
+    if (hardware) { GpioParam::pinRegistry.set(pin); }
 
     // Return a pointer to the hardware used, or a nullptr on failure.
     return hardware;
@@ -282,28 +283,17 @@ void Gpio::setDirection(const Direction direction) noexcept
 void Gpio::setCallback(void (*callback)()) const noexcept
 {
     // Register the given callback for the associated I/O port.
-    if (myHardware->portReg == PORTB)      
-    { 
-        GpioParam::callbacks.add(callback, CallbackIndex::PortB); 
-    }
-    else if (myHardware->portReg == PORTC) 
-    { 
-        GpioParam::callbacks.add(callback, CallbackIndex::PortC); 
-    } 
-    else if (myHardware->portReg == PORTD) 
-    { 
-        GpioParam::callbacks.add(callback, CallbackIndex::PortD); 
-    }
+    GpioParam::callbacks.insert(myHardware->port, callback);
 }
 
 // -----------------------------------------------------------------------------
-ISR (PCINT0_vect) { invokeCallback(CallbackIndex::PortB); }
+ISR (PCINT0_vect) { invokeCallback(Gpio::IoPort::B); }
 
 // -----------------------------------------------------------------------------
-ISR (PCINT1_vect) { invokeCallback(CallbackIndex::PortC); }
+ISR (PCINT1_vect) { invokeCallback(Gpio::IoPort::C); }
 
 // -----------------------------------------------------------------------------
-ISR (PCINT2_vect) { invokeCallback(CallbackIndex::PortD); }
+ISR (PCINT2_vect) { invokeCallback(Gpio::IoPort::D); }
 
 } // namespace atmega328p
 } // namespace driver
@@ -4,6 +4,7 @@
 #include <avr/interrupt.h>
 
 #include "container/array.h"
+#include "container/bitset.h"
 #include "driver/atmega328p/timer.h" 
 #include "utils/callback_array.h"
 #include "utils/utils.h"
@@ -89,6 +90,9 @@ struct TimerParam
 
 	/** Array holding pointers to callbacks. */
 	static CallbackArray<circuitCount> callbacks;
+
+	/** Circuit registry (1 = reserved, 0 = free). */
+	static container::Bitset<circuitCount> circuitRegistry;
 };
 
 /** Array holding pointers to TimerParam::timers. */
@@ -97,6 +101,9 @@ Timer* TimerParam::TimerParam::timers[TimerParam::circuitCount]{};
 /** Array holding pointers to callbacks. */
 CallbackArray<TimerParam::circuitCount> TimerParam::callbacks{};
 
+/** Circuit registry (1 = reserved, 0 = free). */
+container::Bitset<TimerParam::circuitCount> TimerParam::circuitRegistry{};
+
 // -----------------------------------------------------------------------------
 constexpr uint32_t maxCount(const uint32_t elapseTimeMs) noexcept
 {
@@ -225,12 +232,13 @@ bool Timer::increment() noexcept
 // -----------------------------------------------------------------------------
 Timer::Hardware* Timer::Hardware::reserve() noexcept
 {
-	// Reserve a timer circuit if any is available, otherwise return a nullptr.
-    for (uint8_t i{}; i < TimerParam::circuitCount; ++i)
-	{
-        if (nullptr == TimerParam::timers[i]) { return init(i); }
-	}
-	return nullptr;
+	// Reserve the first free timer circuit if any is available, otherwise return a nullptr.
+    const auto index{TimerParam::circuitRegistry.findFirstReset()};
+	if (index >= TimerParam::circuitCount) { return nullptr; }
+
+	auto hardware{init(static_cast<uint8_t>(index))};
+	if (hardware) { TimerParam::circuitRegistry.set(index); }
+	return hardware;
 }
 
 // -----------------------------------------------------------------------------
@@ -255,7 +263,8 @@ void Timer::Hardware::release(Timer::Hardware* hardware) noexcept
 		default:
 		    break;
 	}
-	// Release allocated resources.
+	// Release allocated resources and mark the circuit as free.
+	TimerParam::circuitRegistry.reset(hardware->index);
 	utils::deleteMemory(hardware);
 }
 
@@ -5,6 +5,7 @@
 
 #include <stdint.h>
 
+#include "container/span.h"
 #include "utils/type_traits.h"
 
 namespace driver 
@@ -69,7 +70,28 @@ public:
     template <typename T = uint8_t>
     bool read(const uint16_t address, T& data) const noexcept;
 
+    /**
+     * @brief Write block of bytes to consecutive addresses in EEPROM, starting at given address.
+     *
+     * @param[in] address The first destination address.
+     * @param[in] data View of the bytes to write, e.g. an array or a vector.
+     *
+     * @return True upon successful write, false otherwise.
+     */
+    bool writeBlock(const uint16_t address, const container::Span<const uint8_t> data) const noexcept;
+
+    /**
+     * @brief Read block of bytes from consecutive addresses in EEPROM, starting at given address.
+     *
+     * @param[in] address The first source address.
+     * @param[out] data View of the destination, which is filled with the bytes read.
+     *
+     * @return True upon successful read, false otherwise.
+     */
+    bool readBlock(const uint16_t address, const container::Span<uint8_t> data) const noexcept;
+
 private: 
+    bool isBlockValid(const uint16_t address, const size_t size) const noexcept;
     virtual bool isAddressValid(const uint16_t address, const uint8_t dataSize) const = 0;
     virtual void writeByte(const uint16_t address, const uint8_t data) const = 0;
     virtual uint8_t readByte(const uint16_t address) const = 0;
@@ -83,7 +105,7 @@ bool EepromInterface::write(const uint16_t address, const T& data) const noexcep
     static_assert(type_traits::is_unsigned<T>::value, 
         "EEPROM write only supported for unsigned data types!");
 
-    // Return false is the given address in invalid or if the EEPROM stream isn't enabled.
+    // Return false if the given address is invalid or if the EEPROM stream isn't enabled.
     if (!isAddressValid(address, sizeof(T)) || !isEnabled()) { return false; }
     
     // Write each byte to EEPROM, one at a time.
@@ -103,7 +125,7 @@ bool EepromInterface::read(const uint16_t address, T& data) const noexcept
     static_assert(type_traits::is_unsigned<T>::value, 
         "EEPROM read only supported for unsigned data types!");
 
-    // Return false is the given address in invalid or if the EEPROM stream isn't enabled.
+    // Return false if the given address is invalid or if the EEPROM stream isn't enabled.
     if (!isAddressValid(address, sizeof(T)) || !isEnabled()) { return false; }
     data = {};
 
@@ -115,4 +137,36 @@ bool EepromInterface::read(const uint16_t address, T& data) const noexcept
     // Return true to indicate success.
     return true;
 }
+
+// -----------------------------------------------------------------------------
+inline bool EepromInterface::writeBlock(const uint16_t address, 
+                                        const container::Span<const uint8_t> data) const noexcept
+{
+    // Return false if the given block is invalid or if the EEPROM stream isn't enabled.
+    if (!isBlockValid(address, data.size()) || !isEnabled()) { return false; }
+
+    // Write each byte to EEPROM, one at a time.
+    for (size_t i{}; i < data.size(); ++i) { writeByte(address + i, data[i]); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+inline bool EepromInterface::readBlock(const uint16_t address, 
+                                       const container::Span<uint8_t> data) const noexcept
+{
+    // Return false if the given block is invalid or if the EEPROM stream isn't enabled.
+    if (!isBlockValid(address, data.size()) || !isEnabled()) { return false; }
+
+    // Read each byte from EEPROM, one at a time.
+    for (size_t i{}; i < data.size(); ++i) { data[i] = readByte(address + i); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+inline bool EepromInterface::isBlockValid(const uint16_t address, const size_t size) const noexcept
+{
+    // Check the last address of the block, the size may exceed the range of a single access.
+    if ((size == 0U) || (size - 1U > static_cast<uint16_t>(UINT16_MAX - address))) { return false; }
+    return isAddressValid(static_cast<uint16_t>(address + size - 1U), 1U);
+}
 } // namespace driver
@@ -9,6 +9,7 @@
  *            - An EEPROM stream is used to store the LED state. On startup, this value is read;
  *              if the last stored state before power down was "on," the LED will automatically blink.
  */
+#include "container/progmem_array.h"
 #include "driver/atmega328p/adc.h"
 #include "driver/atmega328p/eeprom.h"
 #include "driver/atmega328p/gpio.h"
@@ -17,11 +18,29 @@
 #include "driver/atmega328p/watchdog.h"
 #include "target/system.h"
 #include "ml/linreg/linreg.h"
+#include "ml/linreg/pretrained.h"
+
+// Use the coefficients exported by the host tool linreg_export if available.
+#if __has_include("ml/linreg/coefficients.h")
+#include "ml/linreg/coefficients.h"
+#define ML_LINREG_PRETRAINED
+#endif
 
 using namespace driver::atmega328p;
 
 namespace
 {
+/** The number of training samples. */
+constexpr size_t trainSampleCount{11U};
+
+/** Training input data, stored in program memory. */
+constexpr container::ProgmemArray<double, trainSampleCount> trainInput PROGMEM{
+    {0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0}};
+
+/** Training output data, stored in program memory. */
+constexpr container::ProgmemArray<double, trainSampleCount> trainOutput PROGMEM{
+    {-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0, 20.0, 30.0, 40.0, 50.0}};
+
 /** Pointer to the system implementation. */
 target::System* mySys{nullptr};
     
@@ -59,17 +78,15 @@ constexpr int round(const double number)
 /**
  * @brief Predict with the given linear regression model.
  * 
+ * @tparam Size The number of input values.
+ * 
  * @param[in] linreg Linear regression model to predict with.
- * @param[in] inputData Input data to predict with.
+ * @param[in] inputData Input data to predict with, stored in program memory.
  */
-void printPredictions(const ml::linreg::Interface& linReg, const container::Vector<double>& inputData) noexcept
+template <size_t Size>
+void printPredictions(const ml::linreg::Interface& linReg, 
+                      const container::ProgmemArray<double, Size>& inputData) noexcept
 {
-    // Terminate the function if no input data is provided.
-    if (inputData.empty())
-    {
-        serial.printf("No input data!\n");
-        return;
-    }
     serial.printf("--------------------------------------------------------------------------------\n");
     // Perform prediction with each input value, print the result in the terminal.
     for (const auto& input : inputData)
@@ -98,18 +115,29 @@ int main()
     // Learingrate for the training.
     constexpr double learningRate{0.225};
     constexpr uint8_t sensorPin{16U};
-    // The data we want to train our model with.
-    const container::Vector<double> trainInput{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0};
-    const container::Vector<double> trainOutput{-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0, 20.0, 30.0, 40.0, 50.0};
+
+#ifdef ML_LINREG_PRETRAINED
+    // Use the coefficients trained on the host, no training is needed on the target.
+    (void) learningRate;
+    ml::linreg::Pretrained linReg{ml::linreg::coefficients::weight, ml::linreg::coefficients::bias,
+                                  ml::linreg::coefficients::epochsUsed};
+    serial.printf("Using pretrained model!\n");
+#else
+    // Copy the training data from program memory, it's only needed in RAM when training on target.
+    double input[trainSampleCount]{};
+    double output[trainSampleCount]{};
+    trainInput.copy(input);
+    trainOutput.copy(output);
 
     // The constructor.
-    ml::linreg::LinReg linReg{trainInput, trainOutput, serial};
+    ml::linreg::LinReg linReg{input, output, serial};
 
     if (!linReg.trainWithNoEpoch(learningRate)) {
         serial.printf("Training failed!\n");
         return -1;
     }
     serial.printf("Training finished!\n");
+#endif
     printPredictions(linReg, trainInput);
     // Gällande ADC:
     // read returnerar ett värde mellan 0 - 1023.
@@ -0,0 +1,165 @@
+/**
+ * @brief Implementation details of fixed-block memory pools and allocators.
+ *
+ * @note Don't include this header, use <pool_allocator.h> instead!
+ */
+#pragma once
+
+#ifdef __AVR__
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#endif
+
+#include "utils/utils.h"
+
+namespace memory
+{
+namespace detail
+{
+/**
+ * @brief Guard disabling interrupts during its lifetime (AVR only).
+ *
+ *        The previous interrupt state is restored on destruction, hence the guard can be
+ *        used both in interrupt service routines and in the main loop.
+ */
+class InterruptGuard
+{
+public:
+    InterruptGuard() noexcept 
+    { 
+#ifdef __AVR__
+        mySreg = SREG;
+        cli(); 
+#endif
+    }
+
+    ~InterruptGuard() noexcept 
+    { 
+#ifdef __AVR__
+        // Prevent the compiler from moving memory accesses past the restore.
+        asm volatile("" ::: "memory");
+        SREG = mySreg; 
+#endif
+    }
+
+    InterruptGuard(const InterruptGuard&)            = delete; // No copy constructor.
+    InterruptGuard(InterruptGuard&&)                 = delete; // No move constructor.
+    InterruptGuard& operator=(const InterruptGuard&) = delete; // No copy assignment.
+    InterruptGuard& operator=(InterruptGuard&&)      = delete; // No move assignment.
+
+private:
+    /** The status register, holding the global interrupt flag, before the guard (AVR only). */
+    uint8_t mySreg{};
+};
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <size_t BlockSize, size_t Alignment, size_t Capacity>
+typename BlockPool<BlockSize, Alignment, Capacity>::FreeBlock*
+    BlockPool<BlockSize, Alignment, Capacity>::myFreeList{nullptr};
+
+// -----------------------------------------------------------------------------
+template <size_t BlockSize, size_t Alignment, size_t Capacity>
+uint8_t* BlockPool<BlockSize, Alignment, Capacity>::myNext{Capacity > 0U ? myStorage : nullptr};
+
+// -----------------------------------------------------------------------------
+template <size_t BlockSize, size_t Alignment, size_t Capacity>
+size_t BlockPool<BlockSize, Alignment, Capacity>::myRemaining{Capacity};
+
+// -----------------------------------------------------------------------------
+template <size_t BlockSize, size_t Alignment, size_t Capacity>
+alignas(BlockPool<BlockSize, Alignment, Capacity>::BlockAlignment)
+    uint8_t BlockPool<BlockSize, Alignment, Capacity>::myStorage[Capacity > 0U ? Capacity * Stride : 1U];
+
+// -----------------------------------------------------------------------------
+template <size_t BlockSize, size_t Alignment, size_t Capacity>
+void* BlockPool<BlockSize, Alignment, Capacity>::allocate() noexcept
+{
+    const detail::InterruptGuard guard{};
+    return allocateBlock();
+}
+
+// -----------------------------------------------------------------------------
+template <size_t BlockSize, size_t Alignment, size_t Capacity>
+void BlockPool<BlockSize, Alignment, Capacity>::deallocate(void* block) noexcept
+{
+    if (block == nullptr) { return; }
+    const detail::InterruptGuard guard{};
+    auto freeBlock{static_cast<FreeBlock*>(block)};
+    freeBlock->next = myFreeList;
+    myFreeList      = freeBlock;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t BlockSize, size_t Alignment, size_t Capacity>
+void* BlockPool<BlockSize, Alignment, Capacity>::allocateBlock() noexcept
+{
+    // Reuse released blocks first.
+    if (myFreeList != nullptr)
+    {
+        auto block{myFreeList};
+        myFreeList = block->next;
+        return block;
+    }
+
+    // Take the next never used block, allocate a new chunk if needed (unbounded pools only).
+    if (myRemaining == 0U)
+    {
+        if constexpr (Capacity > 0U) { return nullptr; }
+        else
+        {
+            myNext = allocateChunk();
+            if (myNext == nullptr) { return nullptr; }
+            myRemaining = ChunkBlockCount;
+        }
+    }
+    auto block{myNext};
+    myNext += Stride;
+    --myRemaining;
+    return block;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t BlockSize, size_t Alignment, size_t Capacity>
+uint8_t* BlockPool<BlockSize, Alignment, Capacity>::allocateChunk() noexcept
+{
+    // The heap only guarantees fundamental alignment, so pad and align over-aligned chunks.
+    // The chunks are never released, hence the original address needn't be kept.
+    if constexpr (BlockAlignment <= alignof(max_align_t))
+    {
+        return utils::newMemory<uint8_t>(ChunkBlockCount * Stride);
+    }
+    else
+    {
+        const auto chunk{utils::newMemory<uint8_t>(ChunkBlockCount * Stride + BlockAlignment - 1U)};
+        if (chunk == nullptr) { return nullptr; }
+        const auto address{reinterpret_cast<uintptr_t>(chunk)};
+        const auto padding{(BlockAlignment - address % BlockAlignment) % BlockAlignment};
+        return chunk + padding;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Capacity>
+template <typename T>
+T* NodeAllocator<Capacity>::allocate() noexcept
+{
+    return static_cast<T*>(BlockPool<sizeof(T), alignof(T), Capacity>::allocate());
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Capacity>
+template <typename T>
+void NodeAllocator<Capacity>::deallocate(T* node) noexcept
+{
+    BlockPool<sizeof(T), alignof(T), Capacity>::deallocate(node);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* HeapAllocator::allocate() noexcept { return utils::newMemory<T>(); }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void HeapAllocator::deallocate(T* node) noexcept { utils::deleteMemory(node); }
+} // namespace memory
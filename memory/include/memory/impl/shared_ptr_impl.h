@@ -36,7 +36,7 @@ SharedPtr<T>::SharedPtr(SharedPtr<T>&& other) noexcept
 
 // -----------------------------------------------------------------------------
 template <typename T>
-SharedPtr<T>::~SharedPtr() noexcept { reset(); }
+SharedPtr<T>::~SharedPtr() noexcept { release(); }
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -116,7 +116,7 @@ T* SharedPtr<T>::release() noexcept
 
 // -----------------------------------------------------------------------------
 template <typename T>
-size_t* SharedPtr<T>::newRefCount() noexcept { return new size_t{1U}; }
+size_t* SharedPtr<T>::newRefCount() noexcept { return utils::newObject<size_t>(1U); }
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -129,7 +129,7 @@ void SharedPtr<T>::decrementReferenceCount() noexcept
 template <typename T>
 void SharedPtr<T>::releaseMemory() noexcept
 {
-    utils::deleteMemory(myData);
+    utils::deleteObject(myData);
     utils::deleteMemory(myRefCount);
     myData     = nullptr;
     myRefCount = nullptr;
@@ -139,13 +139,16 @@ void SharedPtr<T>::releaseMemory() noexcept
 template <typename T, typename... Args>
 SharedPtr<T> makeShared(Args&&... args) noexcept
 {
-    return SharedPtr<T>{utils::newObject(utils::forward<Args>(args)...)};
+    return SharedPtr<T>{utils::newObject<T>(utils::forward<Args>(args)...)};
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
 SharedPtr<T> makeShared() noexcept
 {
+    // The elements of the field aren't constructed, hence they mustn't need destruction.
+    static_assert(type_traits::is_trivially_copyable<T>::value, 
+        "Fields are only supported for trivially copyable types!");
     return SharedPtr<T>{utils::newMemory<T>(Size)};
 }
 
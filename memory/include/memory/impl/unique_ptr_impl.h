@@ -70,7 +70,7 @@ const T* UniquePtr<T>::get() const noexcept { return myData; }
 template <typename T>
 void UniquePtr<T>::reset(T* newData) noexcept
 {
-    utils::deleteMemory(myData);
+    utils::deleteObject(myData);
     myData = newData;
 }
 
@@ -85,15 +85,18 @@ T* UniquePtr<T>::release() noexcept
 
 // -----------------------------------------------------------------------------
 template <typename T, typename... Args>
-UniquePtr<T> makeUnique(Args&&... args)
+UniquePtr<T> makeUnique(Args&&... args) noexcept
 {
-    return UniquePtr<T>{utils::newObject(utils::forward<Args>(args)...)};
+    return UniquePtr<T>{utils::newObject<T>(utils::forward<Args>(args)...)};
 }
 
 // -----------------------------------------------------------------------------
 template <typename T, size_t Size>
-UniquePtr<T> makeUnique()
+UniquePtr<T> makeUnique() noexcept
 {
+    // The elements of the field aren't constructed, hence they mustn't need destruction.
+    static_assert(type_traits::is_trivially_copyable<T>::value, 
+        "Fields are only supported for trivially copyable types!");
     return UniquePtr<T>{utils::newMemory<T>(Size)};
 }
 
@@ -0,0 +1,153 @@
+/**
+ * @brief Implementation of fixed-block memory pools and allocators for node-based containers.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace memory
+{
+/**
+ * @brief Class for implementation of fixed-block memory pools.
+ *
+ *        Blocks are allocated and deallocated in constant time via an intrusive free list.
+ *        Released blocks are reused by later allocations and never returned to the heap,
+ *        hence the heap isn't fragmented by repeated allocations and deallocations.
+ *
+ *        There is one pool per combination of block size, alignment and capacity, which is
+ *        shared by all users, i.e. the free lists are global state. On AVR, allocate and 
+ *        deallocate run with interrupts disabled, so that nodes can be allocated from interrupt 
+ *        service routines while the main loop uses the same pool. This only protects the pool: 
+ *        a container shared between an interrupt service routine and the main loop, e.g. a 
+ *        pool-backed List, must still be guarded by the caller, or replaced by a lock-free 
+ *        structure such as RingBuffer. On other targets the pools aren't thread-safe.
+ *
+ *        Blocks are aligned to the given alignment, also in chunks allocated from the heap.
+ *
+ * @tparam BlockSize The size of each block in bytes.
+ * @tparam Alignment The alignment of each block in bytes.
+ * @tparam Capacity The maximum number of blocks. If 0, the pool has no upper bound and grows
+ *                  in chunks of heap memory, else the blocks are stored in static memory.
+ */
+template <size_t BlockSize, size_t Alignment, size_t Capacity = 0U>
+class BlockPool
+{
+public:
+    /**
+     * @brief Allocate a block.
+     *
+     * @return Pointer to the allocated block, or a nullptr if the pool is exhausted.
+     */
+    static void* allocate() noexcept;
+
+    /**
+     * @brief Release a block previously allocated from this pool.
+     *
+     * @param[in] block Pointer to the block to release. Nothing is done for a nullptr.
+     */
+    static void deallocate(void* block) noexcept;
+
+    BlockPool()                            = delete; // No constructor.
+    BlockPool(const BlockPool&)            = delete; // No copy constructor.
+    BlockPool(BlockPool&&)                 = delete; // No move constructor.
+    BlockPool& operator=(const BlockPool&) = delete; // No copy assignment.
+    BlockPool& operator=(BlockPool&&)      = delete; // No move assignment.
+
+private:
+    /** Released block, which holds the next released block. */
+    struct FreeBlock
+    {
+        FreeBlock* next; // Pointer to the next released block.
+    };
+
+    static constexpr size_t maxValue(const size_t x, const size_t y) noexcept
+    {
+        return x >= y ? x : y;
+    }
+
+    /** The alignment of the blocks, large enough to hold a free block. */
+    static constexpr size_t BlockAlignment{maxValue(Alignment, alignof(FreeBlock))};
+
+    /** The distance between the blocks in bytes. */
+    static constexpr size_t Stride{(maxValue(BlockSize, sizeof(FreeBlock)) + BlockAlignment - 1U) /
+                                   BlockAlignment * BlockAlignment};
+
+    /** The number of blocks in each chunk allocated by unbounded pools. */
+    static constexpr size_t ChunkBlockCount{8U};
+
+    static void* allocateBlock() noexcept;
+    static uint8_t* allocateChunk() noexcept;
+
+    /** Released blocks available for reuse. */
+    static FreeBlock* myFreeList;
+
+    /** The next never used block. */
+    static uint8_t* myNext;
+
+    /** The number of never used blocks left in the current chunk or storage. */
+    static size_t myRemaining;
+
+    /** Static storage holding the blocks of bounded pools. */
+    alignas(BlockAlignment) static uint8_t myStorage[Capacity > 0U ? Capacity * Stride : 1U];
+};
+
+/**
+ * @brief Allocator for container nodes backed by fixed-block memory pools.
+ *
+ *        Each node type uses the pool matching its size and alignment.
+ *
+ * @tparam Capacity The maximum number of nodes per pool. If 0, the pools have no upper bound.
+ */
+template <size_t Capacity = 0U>
+struct NodeAllocator
+{
+    /**
+     * @brief Allocate uninitialized memory for a node.
+     *
+     * @tparam T The node type.
+     *
+     * @return Pointer to the allocated memory, or a nullptr if the pool is exhausted.
+     */
+    template <typename T>
+    static T* allocate() noexcept;
+
+    /**
+     * @brief Release memory of a node. The node must already be destroyed.
+     *
+     * @tparam T The node type.
+     *
+     * @param[in] node Pointer to the node to release.
+     */
+    template <typename T>
+    static void deallocate(T* node) noexcept;
+};
+
+/**
+ * @brief Allocator for container nodes using the heap directly.
+ */
+struct HeapAllocator
+{
+    /**
+     * @brief Allocate uninitialized memory for a node.
+     *
+     * @tparam T The node type.
+     *
+     * @return Pointer to the allocated memory, or a nullptr if the allocation failed.
+     */
+    template <typename T>
+    static T* allocate() noexcept;
+
+    /**
+     * @brief Release memory of a node. The node must already be destroyed.
+     *
+     * @tparam T The node type.
+     *
+     * @param[in] node Pointer to the node to release.
+     */
+    template <typename T>
+    static void deallocate(T* node) noexcept;
+};
+} // namespace memory
+
+#include "impl/pool_allocator_impl.h"
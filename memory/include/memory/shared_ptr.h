@@ -151,7 +151,8 @@ SharedPtr<T> makeShared(Args&&... args) noexcept;
 /**
  * @brief Create shared pointer pointing at new field of given size.
  * 
- * @tparam T    The pointer/field type.
+ * @tparam T    The pointer/field type, must be trivially copyable since the elements 
+ *              aren't constructed.
  * @tparam Size The size of new field.
  * 
  * @return Shared pointer holding ownership over the new field.
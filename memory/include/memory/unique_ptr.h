@@ -133,7 +133,8 @@ UniquePtr<T> makeUnique(Args&&... args) noexcept;
 /**
  * @brief Create unique pointer pointing at new field of given size.
  * 
- * @tparam T    The pointer/field type.
+ * @tparam T    The pointer/field type, must be trivially copyable since the elements 
+ *              aren't constructed.
  * @tparam Size The size of new field.
  * 
  * @return Unique pointer holding ownership over the new field.
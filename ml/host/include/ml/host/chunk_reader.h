@@ -0,0 +1,221 @@
+/**
+ * @brief Chunked streaming reader for out-of-core training (host build only).
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ml/host/dataset.h"
+
+namespace ml
+{
+namespace host
+{
+/**
+ * @brief Non-owning view of a chunk of input/output pairs.
+ */
+struct Chunk
+{
+    /** Pointer to the input values of the chunk. */
+    const double* input;
+
+    /** Pointer to the output values of the chunk. */
+    const double* output;
+
+    /** The number of input/output pairs in the chunk. */
+    size_t size;
+};
+
+/**
+ * @brief Streaming reader yielding fixed-size chunks of input/output pairs.
+ *
+ *        Data is read from a CSV file or a binary dataset file (see dataset.h). Two chunk
+ *        buffers are used: while the caller processes one chunk, the next chunk is read into
+ *        the other buffer by a background thread. Memory usage is therefore constant
+ *        regardless of the size of the file.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class ChunkReader final
+{
+public:
+    /**
+     * @brief Enumeration of supported file formats.
+     */
+    enum class Format : uint8_t
+    {
+        Csv,    // Comma-separated values, one row per line. Malformed lines are skipped.
+        Binary, // Columnar binary dataset file.
+        Count,  // The number of supported file formats.
+    };
+
+    /**
+     * @brief Create new chunk reader.
+     *
+     * @param[in] chunkSize The maximum number of input/output pairs per chunk.
+     */
+    explicit ChunkReader(const size_t chunkSize) noexcept;
+
+    /**
+     * @brief Delete chunk reader, the opened file (if any) is closed.
+     */
+    ~ChunkReader() noexcept;
+
+    /**
+     * @brief Open given file and start reading the first chunk.
+     *
+     *        Any previously opened file is closed first.
+     *
+     * @param[in] path The path to the file.
+     * @param[in] format The file format.
+     * @param[in] inputColumn Index of the column holding the input values (default = 0).
+     * @param[in] outputColumn Index of the column holding the output values (default = 1).
+     *
+     * @return True if the file was opened, false if it couldn't be opened or if the chunk 
+     *         buffers or the background thread couldn't be created.
+     */
+    bool open(const char* path, const Format format, const size_t inputColumn = 0U,
+              const size_t outputColumn = 1U) noexcept;
+
+    /**
+     * @brief Close the opened file (if any).
+     */
+    void close() noexcept;
+
+    /**
+     * @brief Check if a file is opened.
+     *
+     * @return True if a file is opened, false otherwise.
+     */
+    bool isOpen() const noexcept;
+
+    /**
+     * @brief Get the next chunk, block until it has been read.
+     *
+     *        The chunk stays valid until the next call to next(), rewind() or close().
+     *
+     * @param[out] chunk Reference to the chunk to assign.
+     *
+     * @return True if a chunk was assigned, false at the end of the file.
+     */
+    bool next(Chunk& chunk) noexcept;
+
+    /**
+     * @brief Restart reading from the beginning of the file.
+     *
+     *        The background thread is kept running, it discards any prefetched chunk and 
+     *        continues from the beginning of the file. Rewinding before the first chunk has 
+     *        been consumed has no effect.
+     *
+     * @return True if the reader was rewound, false otherwise.
+     */
+    bool rewind() noexcept;
+
+    /**
+     * @brief Get the number of CSV lines skipped since the file was opened or rewound.
+     *
+     *        Lines are skipped if the requested columns can't be parsed, e.g. header lines, 
+     *        or if they are longer than the maximum supported line length.
+     *
+     * @return The number of skipped lines.
+     */
+    size_t malformedCount() const noexcept;
+
+    /**
+     * @brief Get the maximum number of input/output pairs per chunk.
+     *
+     * @return The chunk size.
+     */
+    size_t chunkSize() const noexcept;
+
+    ChunkReader()                              = delete; // No default constructor.
+    ChunkReader(const ChunkReader&)            = delete; // No copy constructor.
+    ChunkReader(ChunkReader&&)                 = delete; // No move constructor.
+    ChunkReader& operator=(const ChunkReader&) = delete; // No copy assignment.
+    ChunkReader& operator=(ChunkReader&&)      = delete; // No move assignment.
+
+private:
+    struct Buffer
+    {
+        std::vector<double> input;  // Input values.
+        std::vector<double> output; // Output values.
+        size_t size;                // The number of input/output pairs read.
+        bool ready;                 // Indicate whether the buffer holds a chunk to consume.
+    };
+
+    bool start() noexcept;
+    bool abortOpen() noexcept;
+    void stop() noexcept;
+    void produce() noexcept;
+    bool restart() noexcept;
+    size_t fill(Buffer& buffer) noexcept;
+    size_t fillFromCsv(Buffer& buffer) noexcept;
+    size_t fillFromBinary(Buffer& buffer) noexcept;
+
+    /** The maximum number of input/output pairs per chunk. */
+    const size_t myChunkSize;
+
+    /** Chunk buffers, one is consumed while the other is filled. */
+    Buffer myBuffers[2U]{};
+
+    /** Index of the next buffer to consume. */
+    size_t myConsumerIndex{};
+
+    /** Indicate whether a chunk is currently lent to the caller. */
+    bool myLent{};
+
+    /** Indicate whether any chunk has been consumed since the file was opened or rewound. */
+    bool myConsumed{};
+
+    /** The format of the opened file. */
+    Format myFormat{Format::Count};
+
+    /** The opened CSV file (if any). */
+    FILE* myCsvFile{nullptr};
+
+    /** The opened binary dataset (if any). */
+    Dataset myDataset{};
+
+    /** Index of the input column. */
+    size_t myInputColumn{};
+
+    /** Index of the output column. */
+    size_t myOutputColumn{};
+
+    /** Index of the next row to read from the binary dataset. */
+    size_t myRow{};
+
+    /** Background thread reading the next chunk. */
+    std::thread myThread{};
+
+    /** Mutex protecting the buffer states. */
+    std::mutex myMutex{};
+
+    /** Condition signaled whenever a buffer state changes. */
+    std::condition_variable myCondition{};
+
+    /** Indicate whether the background thread shall stop. */
+    bool myStopRequested{};
+
+    /** Indicate whether the background thread shall restart from the beginning of the file. */
+    bool myRewindRequested{};
+
+    /** Indicate whether the last rewind succeeded. */
+    bool myRewindSucceeded{};
+
+    /** Indicate whether the background thread has read the last chunk. */
+    bool myEndReached{};
+
+    /** The number of CSV lines skipped since the file was opened or rewound. */
+    std::atomic<size_t> myMalformedCount{};
+};
+} // namespace host
+} // namespace ml
@@ -0,0 +1,176 @@
+/**
+ * @brief Columnar binary dataset files with a memory-mapped loader (host build only).
+ *
+ *        File layout (little endian):
+ *
+ *            - Header: magic "LRDS", version (uint16), column count (uint16), row count (uint64)
+ *              and 16 reserved bytes, 32 bytes in total.
+ *
+ *            - One descriptor per column: column type (uint8), 7 reserved bytes and the byte
+ *              offset of the column data from the start of the file (uint64), 16 bytes each.
+ *
+ *            - Column data, one contiguous block of row count values per column. Each block
+ *              starts at an 8-byte aligned offset, so columns can be used in place.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ml
+{
+namespace host
+{
+/**
+ * @brief Enumeration of supported column types.
+ */
+enum class ColumnType : uint8_t
+{
+    Float32, // 32-bit floating-point values (float).
+    Float64, // 64-bit floating-point values (double).
+    Count,   // The number of supported column types.
+};
+
+/**
+ * @brief Non-owning view of a column.
+ */
+struct ColumnView
+{
+    /** Pointer to the first value of the column. */
+    const void* data;
+
+    /** The number of values in the column. */
+    size_t size;
+
+    /** The column type. */
+    ColumnType type;
+
+    /**
+     * @brief Get the column values as floats.
+     *
+     * @return Pointer to the values, or a nullptr if the column doesn't hold floats.
+     */
+    const float* asFloat() const noexcept
+    {
+        return ColumnType::Float32 == type ? static_cast<const float*>(data) : nullptr;
+    }
+
+    /**
+     * @brief Get the column values as doubles.
+     *
+     * @return Pointer to the values, or a nullptr if the column doesn't hold doubles.
+     */
+    const double* asDouble() const noexcept
+    {
+        return ColumnType::Float64 == type ? static_cast<const double*>(data) : nullptr;
+    }
+};
+
+/**
+ * @brief Read-only, memory-mapped columnar dataset.
+ *
+ *        Column views point straight into the mapped file, no data is parsed or copied.
+ *        The views are valid until the dataset is closed or deleted.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Dataset final
+{
+public:
+    /**
+     * @brief Create dataset without any file opened.
+     */
+    Dataset() noexcept = default;
+
+    /**
+     * @brief Delete dataset, the file is unmapped if open.
+     */
+    ~Dataset() noexcept;
+
+    /**
+     * @brief Map given dataset file into memory.
+     *
+     *        Any previously opened file is closed first.
+     *
+     * @param[in] path The path to the dataset file.
+     *
+     * @return True if the file was opened and its content is valid, false otherwise.
+     */
+    bool open(const char* path) noexcept;
+
+    /**
+     * @brief Unmap the opened file (if any).
+     */
+    void close() noexcept;
+
+    /**
+     * @brief Check if a dataset file is opened.
+     *
+     * @return True if a dataset file is opened, false otherwise.
+     */
+    bool isOpen() const noexcept;
+
+    /**
+     * @brief Get the number of rows in the dataset.
+     *
+     * @return The number of rows, i.e. the number of values in each column.
+     */
+    size_t rowCount() const noexcept;
+
+    /**
+     * @brief Get the number of columns in the dataset.
+     *
+     * @return The number of columns.
+     */
+    size_t columnCount() const noexcept;
+
+    /**
+     * @brief Get a view of the column at given index.
+     *
+     * @param[in] index The index of the column.
+     *
+     * @return View of the column, or an empty view if the index is invalid.
+     */
+    ColumnView column(const size_t index) const noexcept;
+
+    /**
+     * @brief Write given columns to a new dataset file.
+     *
+     *        All columns must hold the same number of values.
+     *
+     * @param[in] path The path to the dataset file to write.
+     * @param[in] columns Pointer to the columns to write.
+     * @param[in] columnCount The number of columns to write.
+     *
+     * @return True if the file was written, false otherwise.
+     */
+    static bool write(const char* path, const ColumnView* columns, const size_t columnCount) noexcept;
+
+    Dataset(const Dataset&)            = delete; // No copy constructor.
+    Dataset(Dataset&&)                 = delete; // No move constructor.
+    Dataset& operator=(const Dataset&) = delete; // No copy assignment.
+    Dataset& operator=(Dataset&&)      = delete; // No move assignment.
+
+private:
+    struct Header;
+    struct Descriptor;
+
+    bool validate() noexcept;
+
+    /** Pointer to the start of the mapped file. */
+    const uint8_t* myData{nullptr};
+
+    /** The size of the mapped file in bytes. */
+    size_t myFileSize{};
+
+    /** Pointer to the column descriptors within the mapped file. */
+    const Descriptor* myDescriptors{nullptr};
+
+    /** The number of rows in the dataset. */
+    size_t myRowCount{};
+
+    /** The number of columns in the dataset. */
+    size_t myColumnCount{};
+};
+} // namespace host
+} // namespace ml
@@ -0,0 +1,90 @@
+/**
+ * @brief Vectorized batch kernels for linear regression models (host build only).
+ */
+#pragma once
+
+#include <stddef.h>
+
+namespace ml
+{
+namespace host
+{
+namespace kernels
+{
+/**
+ * @brief Gradient partial sums for the linear regression model y = kx + m.
+ */
+struct GradientSums
+{
+    /** Sum of errors, e = yref - ypred. */
+    double errorSum;
+
+    /** Sum of errors multiplied by the corresponding input, e * x. */
+    double weightedErrorSum;
+
+    /** Sum of squared errors, e * e. */
+    double squaredErrorSum;
+
+    /** Largest absolute error (only valid if nonFinite is false). */
+    double maxAbsError;
+
+    /** Indicate if any error was NaN or infinite, i.e. if the model has diverged. */
+    bool nonFinite;
+};
+
+/**
+ * @brief Predict the output for each given input, ypred = kx + m.
+ *
+ * @param[in] input Pointer to the input data.
+ * @param[out] output Pointer to the output buffer. Must hold at least count elements.
+ * @param[in] count The number of values to predict.
+ * @param[in] weight The weight of the model (k).
+ * @param[in] bias The bias of the model (m).
+ */
+void predict(const double* input, double* output, const size_t count,
+             const double weight, const double bias) noexcept;
+
+/**
+ * @brief Calculate the sum of squared prediction errors.
+ *
+ *        Unlike gradientSums, only the squared errors are accumulated, which makes this
+ *        kernel suitable for cheap evaluation of validation data.
+ *
+ * @param[in] input Pointer to the input data.
+ * @param[in] reference Pointer to the reference output data.
+ * @param[in] count The number of input/output pairs.
+ * @param[in] weight The weight of the model (k).
+ * @param[in] bias The bias of the model (m).
+ *
+ * @return The sum of squared errors. The sum is NaN or infinite if any error is.
+ */
+double sumSquaredError(const double* input, const double* reference, const size_t count,
+                       const double weight, const double bias) noexcept;
+
+/**
+ * @brief Calculate the gradient partial sums of given input/output pairs.
+ *
+ * @param[in] input Pointer to the input data.
+ * @param[in] reference Pointer to the reference output data.
+ * @param[in] count The number of input/output pairs.
+ * @param[in] weight The weight of the model (k).
+ * @param[in] bias The bias of the model (m).
+ *
+ * @return The gradient partial sums.
+ */
+GradientSums gradientSums(const double* input, const double* reference, const size_t count,
+                          const double weight, const double bias) noexcept;
+
+/**
+ * @brief Get the name of the instruction set selected for the kernels.
+ *
+ *        The instruction set is selected once, at the first kernel call, based on the
+ *        capabilities of the CPU. Define ML_HOST_KERNELS_SCALAR to always use the scalar
+ *        fallback.
+ *
+ * @return "avx2", "sse2" or "scalar".
+ */
+const char* instructionSet() noexcept;
+} // namespace kernels
+} // namespace host
+} // namespace ml
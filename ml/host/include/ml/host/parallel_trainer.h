@@ -0,0 +1,158 @@
+/**
+ * @brief Data-parallel batch trainer for linear regression models (host build only).
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "container/span.h"
+#include "ml/linreg/interface.h"
+
+namespace ml
+{
+namespace host
+{
+/**
+ * @brief Data-parallel batch trainer for linear regression models.
+ *
+ *        The training set is split into one contiguous range per worker thread. Each thread
+ *        accumulates its gradient partial sums in a cache-line padded slot, after which the
+ *        slots are reduced in thread order. The result is therefore deterministic for a fixed
+ *        thread count.
+ *
+ *        The training data is referenced, not copied, and must outlive the trainer.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class ParallelTrainer final : public linreg::Interface
+{
+public:
+    /**
+     * @brief Create a new trainer.
+     *
+     * @param[in] trainInput Pointer to the training input data.
+     * @param[in] trainOutput Pointer to the training output data.
+     * @param[in] setCount The number of training sets, i.e. input/output pairs.
+     * @param[in] threadCount The number of worker threads to use (default = 0, which means
+     *                        one thread per available core).
+     */
+    explicit ParallelTrainer(const double* trainInput, const double* trainOutput,
+                             const size_t setCount, const unsigned threadCount = 0U) noexcept;
+
+    /**
+     * @brief Create a new trainer.
+     *
+     * @param[in] trainInput View of the training input data, e.g. a vector or an array.
+     * @param[in] trainOutput View of the training output data, e.g. a vector or an array.
+     * @param[in] threadCount The number of worker threads to use (default = 0, which means
+     *                        one thread per available core).
+     */
+    explicit ParallelTrainer(const container::Span<const double> trainInput,
+                             const container::Span<const double> trainOutput,
+                             const unsigned threadCount = 0U) noexcept;
+
+    /**
+     * @brief Delete the trainer.
+     */
+    ~ParallelTrainer() noexcept override = default;
+
+    /**
+     * @brief Predict with the trained model.
+     *
+     * @param[in] input The input to predict with.
+     *
+     * @return The predicted value.
+     */
+    double predict(const double input) const noexcept override;
+
+    /**
+     * @brief Train the model with full-batch gradient descent.
+     *
+     *        Training stops when the prediction error of every training set is within the
+     *        given tolerance, or when the given number of epochs have been used. Training is
+     *        aborted if the model diverges, i.e. if any prediction error becomes NaN or 
+     *        infinite, or if the worker threads or their buffers can't be created.
+     *
+     * @param[in] learningRate The learning rate to use.
+     * @param[in] maxEpochs The maximum number of epochs to use.
+     * @param[in] tolerance The maximum allowed prediction error (default = 1e-4).
+     *
+     * @return True if the model converged, false if it didn't converge, diverged or 
+     *         couldn't be trained.
+     */
+    bool train(const double learningRate, const size_t maxEpochs,
+               const double tolerance = 1e-4) noexcept;
+
+    /**
+     * @brief Get the number of epochs used during the last training.
+     *
+     * @return The number of epochs used.
+     */
+    int getEpochsUsed() const noexcept override;
+
+    /**
+     * @brief Get the bias of the model.
+     *
+     * @return The bias of the model.
+     */
+    double getBias() const noexcept override;
+
+    /**
+     * @brief Get the weight of the model.
+     *
+     * @return The weight of the model.
+     */
+    double getWeight() const noexcept override;
+
+    /**
+     * @brief Get the mean squared error of the last epoch.
+     *
+     * @return The mean squared error of the last epoch.
+     */
+    double meanSquaredError() const noexcept;
+
+    /**
+     * @brief Get the number of worker threads used for training.
+     *
+     * @return The number of worker threads.
+     */
+    unsigned threadCount() const noexcept;
+
+    ParallelTrainer()                                  = delete; // No default constructor.
+    ParallelTrainer(const ParallelTrainer&)            = delete; // No copy constructor.
+    ParallelTrainer(ParallelTrainer&&)                 = delete; // No move constructor.
+    ParallelTrainer& operator=(const ParallelTrainer&) = delete; // No copy assignment.
+    ParallelTrainer& operator=(ParallelTrainer&&)      = delete; // No move assignment.
+
+private:
+    struct Partial;
+    class Barrier;
+
+    void accumulate(Partial& partial, const size_t begin, const size_t end) const noexcept;
+
+    /** Pointer to the training input data. */
+    const double* myTrainInput;
+
+    /** Pointer to the training output data. */
+    const double* myTrainOutput;
+
+    /** The number of training sets. */
+    size_t mySetCount;
+
+    /** The number of worker threads. */
+    unsigned myThreadCount;
+
+    /** Bias value of the model, (m) in the equation kx + m = y. */
+    double myBias{};
+
+    /** Weight value of the model, (k) in the equation kx + m = y. */
+    double myWeight{};
+
+    /** Mean squared error of the last epoch. */
+    double myMeanSquaredError{};
+
+    /** The number of epochs used during the last training. */
+    int myEpochsUsed{};
+};
+} // namespace host
+} // namespace ml
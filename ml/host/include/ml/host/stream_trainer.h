@@ -0,0 +1,119 @@
+/**
+ * @brief Out-of-core trainer for linear regression models (host build only).
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "ml/linreg/interface.h"
+
+namespace ml
+{
+namespace host
+{
+class ChunkReader;
+
+/**
+ * @brief Mini-batch and online trainer for linear regression models fed by a chunk reader.
+ *
+ *        Only one chunk is held in memory at a time, so datasets larger than the available
+ *        memory can be used for training.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class StreamTrainer final : public linreg::Interface
+{
+public:
+    /**
+     * @brief Create a new trainer with bias and weight set to 0.
+     */
+    StreamTrainer() noexcept = default;
+
+    /**
+     * @brief Delete the trainer.
+     */
+    ~StreamTrainer() noexcept override = default;
+
+    /**
+     * @brief Predict with the trained model.
+     *
+     * @param[in] input The input to predict with.
+     *
+     * @return The predicted value.
+     */
+    double predict(const double input) const noexcept override;
+
+    /**
+     * @brief Train the model with mini-batch gradient descent, one gradient step per chunk.
+     *
+     *        The reader is rewound before each epoch.
+     *
+     * @param[in] reader Reference to the reader providing the training data.
+     * @param[in] learningRate The learning rate to use.
+     * @param[in] epochs The number of epochs to use.
+     *
+     * @return True if the model was trained, false otherwise, e.g. if the model diverged.
+     */
+    bool trainMiniBatch(ChunkReader& reader, const double learningRate, const size_t epochs) noexcept;
+
+    /**
+     * @brief Train the model with online (stochastic) gradient descent, one step per sample.
+     *
+     *        The reader is rewound before each epoch.
+     *
+     * @param[in] reader Reference to the reader providing the training data.
+     * @param[in] learningRate The learning rate to use.
+     * @param[in] epochs The number of epochs to use.
+     *
+     * @return True if the model was trained, false otherwise, e.g. if the model diverged.
+     */
+    bool trainOnline(ChunkReader& reader, const double learningRate, const size_t epochs) noexcept;
+
+    /**
+     * @brief Get the number of epochs used during the last training.
+     *
+     * @return The number of epochs used.
+     */
+    int getEpochsUsed() const noexcept override;
+
+    /**
+     * @brief Get the bias of the model.
+     *
+     * @return The bias of the model.
+     */
+    double getBias() const noexcept override;
+
+    /**
+     * @brief Get the weight of the model.
+     *
+     * @return The weight of the model.
+     */
+    double getWeight() const noexcept override;
+
+    /**
+     * @brief Get the mean squared error of the last epoch.
+     *
+     * @return The mean squared error of the last epoch.
+     */
+    double meanSquaredError() const noexcept;
+
+    StreamTrainer(const StreamTrainer&)            = delete; // No copy constructor.
+    StreamTrainer(StreamTrainer&&)                 = delete; // No move constructor.
+    StreamTrainer& operator=(const StreamTrainer&) = delete; // No copy assignment.
+    StreamTrainer& operator=(StreamTrainer&&)      = delete; // No move assignment.
+
+private:
+    /** Bias value of the model, (m) in the equation kx + m = y. */
+    double myBias{};
+
+    /** Weight value of the model, (k) in the equation kx + m = y. */
+    double myWeight{};
+
+    /** Mean squared error of the last epoch. */
+    double myMeanSquaredError{};
+
+    /** The number of epochs used during the last training. */
+    int myEpochsUsed{};
+};
+} // namespace host
+} // namespace ml
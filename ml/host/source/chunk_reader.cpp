@@ -0,0 +1,356 @@
+/**
+ * @brief Implementation details of the chunked streaming reader (host build only).
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <new>
+#include <stdexcept>
+#include <system_error>
+
+#include "ml/host/chunk_reader.h"
+
+namespace ml
+{
+namespace host
+{
+namespace
+{
+/** The maximum supported length of a CSV line, including the terminating character. */
+constexpr size_t CsvLineLength{512U};
+
+// -----------------------------------------------------------------------------
+bool parseCsvRow(const char* line, const size_t inputColumn, const size_t outputColumn,
+                 double& input, double& output) noexcept
+{
+    // Parse each comma-separated field until both requested columns have been found.
+    auto inputFound{false}, outputFound{false};
+    auto field{line};
+
+    for (size_t column{}; (!inputFound || !outputFound) && (nullptr != field); ++column)
+    {
+        if ((inputColumn == column) || (outputColumn == column))
+        {
+            char* end{nullptr};
+            const auto value{strtod(field, &end)};
+            if (end == field) { return false; }
+
+            if (inputColumn == column) { input = value; inputFound = true; }
+            if (outputColumn == column) { output = value; outputFound = true; }
+        }
+        field = strchr(field, ',');
+        if (nullptr != field) { ++field; }
+    }
+    return inputFound && outputFound;
+}
+
+// -----------------------------------------------------------------------------
+void copyColumn(const ColumnView& column, const size_t firstRow, const size_t count,
+                double* destination) noexcept
+{
+    if (ColumnType::Float64 == column.type)
+    {
+        memcpy(destination, column.asDouble() + firstRow, count * sizeof(double));
+    }
+    else
+    {
+        const auto source{column.asFloat() + firstRow};
+        for (size_t i{}; i < count; ++i) { destination[i] = static_cast<double>(source[i]); }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void releasePages(const ColumnView& column, const size_t firstRow, const size_t count) noexcept
+{
+    // Drop the pages holding consumed rows, they are read from the file again if needed.
+    static const auto pageSize{static_cast<uintptr_t>(sysconf(_SC_PAGESIZE))};
+    const auto valueSize{ColumnType::Float64 == column.type ? sizeof(double) : sizeof(float)};
+    const auto begin{reinterpret_cast<uintptr_t>(column.data) + firstRow * valueSize};
+    const auto alignedBegin{begin & ~(pageSize - 1U)};
+    const auto alignedEnd{(begin + count * valueSize) & ~(pageSize - 1U)};
+
+    if (alignedBegin < alignedEnd)
+    {
+        (void) madvise(reinterpret_cast<void*>(alignedBegin), alignedEnd - alignedBegin, MADV_DONTNEED);
+    }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+ChunkReader::ChunkReader(const size_t chunkSize) noexcept
+    : myChunkSize{0U < chunkSize ? chunkSize : 1U} {}
+
+// -----------------------------------------------------------------------------
+ChunkReader::~ChunkReader() noexcept { close(); }
+
+// -----------------------------------------------------------------------------
+bool ChunkReader::open(const char* path, const Format format, const size_t inputColumn,
+                       const size_t outputColumn) noexcept
+{
+    close();
+    if ((nullptr == path) || (Format::Count <= format)) { return false; }
+
+    if (Format::Csv == format)
+    {
+        myCsvFile = fopen(path, "r");
+        if (nullptr == myCsvFile) { return false; }
+    }
+    else
+    {
+        // Both columns must exist in the dataset.
+        if (!myDataset.open(path) || (inputColumn >= myDataset.columnCount()) ||
+            (outputColumn >= myDataset.columnCount()))
+        {
+            myDataset.close();
+            return false;
+        }
+    }
+
+    myFormat       = format;
+    myInputColumn  = inputColumn;
+    myOutputColumn = outputColumn;
+    myRow          = 0U;
+
+    // Report failure rather than letting bad_alloc or length_error escape for huge chunks.
+    try
+    {
+        for (auto& buffer : myBuffers)
+        {
+            buffer.input.resize(myChunkSize);
+            buffer.output.resize(myChunkSize);
+        }
+    }
+    catch (const std::bad_alloc&) { return abortOpen(); }
+    catch (const std::length_error&) { return abortOpen(); }
+    return start() ? true : abortOpen();
+}
+
+// -----------------------------------------------------------------------------
+void ChunkReader::close() noexcept
+{
+    stop();
+    if (nullptr != myCsvFile) { fclose(myCsvFile); }
+    myCsvFile = nullptr;
+    myDataset.close();
+    myFormat = Format::Count;
+}
+
+// -----------------------------------------------------------------------------
+bool ChunkReader::isOpen() const noexcept { return Format::Count != myFormat; }
+
+// -----------------------------------------------------------------------------
+bool ChunkReader::next(Chunk& chunk) noexcept
+{
+    if (!isOpen()) { return false; }
+    std::unique_lock<std::mutex> lock{myMutex};
+
+    // Hand the previously lent buffer back to the background thread.
+    if (myLent)
+    {
+        myBuffers[myConsumerIndex].ready = false;
+        myConsumerIndex ^= 1U;
+        myLent = false;
+        myCondition.notify_all();
+    }
+
+    // Wait for the next chunk, an empty chunk indicates the end of the file.
+    auto& buffer{myBuffers[myConsumerIndex]};
+    myCondition.wait(lock, [&] { return buffer.ready; });
+    myConsumed = true;
+    if (0U == buffer.size) { return false; }
+
+    chunk  = Chunk{buffer.input.data(), buffer.output.data(), buffer.size};
+    myLent = true;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool ChunkReader::rewind() noexcept
+{
+    if (!isOpen()) { return false; }
+    std::unique_lock<std::mutex> lock{myMutex};
+
+    // Nothing to do if reading already starts from the beginning of the file.
+    if (!myConsumed) { return true; }
+
+    // Let the background thread reset the file position, it owns the file while running.
+    myRewindRequested = true;
+    myCondition.notify_all();
+    myCondition.wait(lock, [&] { return !myRewindRequested; });
+    return myRewindSucceeded;
+}
+
+// -----------------------------------------------------------------------------
+size_t ChunkReader::malformedCount() const noexcept { return myMalformedCount; }
+
+// -----------------------------------------------------------------------------
+size_t ChunkReader::chunkSize() const noexcept { return myChunkSize; }
+
+// -----------------------------------------------------------------------------
+bool ChunkReader::start() noexcept
+{
+    for (auto& buffer : myBuffers)
+    {
+        buffer.size  = 0U;
+        buffer.ready = false;
+    }
+    myConsumerIndex   = 0U;
+    myLent            = false;
+    myConsumed        = false;
+    myStopRequested   = false;
+    myRewindRequested = false;
+    myEndReached      = false;
+    myMalformedCount  = 0U;
+
+    try { myThread = std::thread{&ChunkReader::produce, this}; }
+    catch (const std::system_error&) { return false; }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool ChunkReader::abortOpen() noexcept
+{
+    // Close the file and release the buffers, which may be partially allocated.
+    close();
+    for (auto& buffer : myBuffers)
+    {
+        std::vector<double>{}.swap(buffer.input);
+        std::vector<double>{}.swap(buffer.output);
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+void ChunkReader::stop() noexcept
+{
+    if (!myThread.joinable()) { return; }
+    {
+        std::lock_guard<std::mutex> lock{myMutex};
+        myStopRequested = true;
+    }
+    myCondition.notify_all();
+    myThread.join();
+}
+
+// -----------------------------------------------------------------------------
+void ChunkReader::produce() noexcept
+{
+    // Fill the buffers alternately, idle after the first empty chunk until rewound or stopped.
+    size_t index{};
+    while (true)
+    {
+        auto& buffer{myBuffers[index]};
+        {
+            std::unique_lock<std::mutex> lock{myMutex};
+            myCondition.wait(lock, [&] 
+            { 
+                return myStopRequested || myRewindRequested || (!myEndReached && !buffer.ready); 
+            });
+            if (myStopRequested) { return; }
+
+            if (myRewindRequested)
+            {
+                // The consumer waits in rewind(), so every buffer can be reset under the lock.
+                myRewindSucceeded = restart();
+                myRewindRequested = false;
+                index             = 0U;
+                myCondition.notify_all();
+                continue;
+            }
+        }
+
+        // The buffer isn't ready, hence not used by the consumer, so fill it without the lock.
+        const auto size{fill(buffer)};
+        {
+            std::lock_guard<std::mutex> lock{myMutex};
+            buffer.size  = size;
+            buffer.ready = true;
+            myEndReached = 0U == size;
+        }
+        myCondition.notify_all();
+        index ^= 1U;
+    }
+}
+
+// -----------------------------------------------------------------------------
+bool ChunkReader::restart() noexcept
+{
+    // Discard the prefetched chunks, then move to the beginning of the file.
+    for (auto& buffer : myBuffers)
+    {
+        buffer.size  = 0U;
+        buffer.ready = false;
+    }
+    myConsumerIndex  = 0U;
+    myLent           = false;
+    myConsumed       = false;
+    myEndReached     = false;
+    myMalformedCount = 0U;
+    myRow            = 0U;
+
+    // Report the end of the file right away if the file position can't be reset.
+    if ((Format::Csv == myFormat) && (0 != fseek(myCsvFile, 0L, SEEK_SET)))
+    {
+        myBuffers[0U].ready = true;
+        myEndReached        = true;
+        return false;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+size_t ChunkReader::fill(Buffer& buffer) noexcept
+{
+    return Format::Csv == myFormat ? fillFromCsv(buffer) : fillFromBinary(buffer);
+}
+
+// -----------------------------------------------------------------------------
+size_t ChunkReader::fillFromCsv(Buffer& buffer) noexcept
+{
+    char line[CsvLineLength];
+    size_t count{};
+
+    while ((count < myChunkSize) && (nullptr != fgets(line, sizeof(line), myCsvFile)))
+    {
+        // A line without newline is complete only if it ends at the end of the file.
+        const auto length{strlen(line)};
+        if ((0U < length) && ('\n' != line[length - 1U]))
+        {
+            auto c{fgetc(myCsvFile)};
+            if ((EOF != c) && ('\n' != c))
+            {
+                // Skip the rest of the line, else its tail would be parsed as a bogus row.
+                while ((EOF != c) && ('\n' != c)) { c = fgetc(myCsvFile); }
+                ++myMalformedCount;
+                continue;
+            }
+        }
+
+        if (parseCsvRow(line, myInputColumn, myOutputColumn, buffer.input[count], buffer.output[count]))
+        {
+            ++count;
+        }
+        else { ++myMalformedCount; }
+    }
+    return count;
+}
+
+// -----------------------------------------------------------------------------
+size_t ChunkReader::fillFromBinary(Buffer& buffer) noexcept
+{
+    const auto remaining{myDataset.rowCount() - myRow};
+    const auto count{myChunkSize < remaining ? myChunkSize : remaining};
+    const auto input{myDataset.column(myInputColumn)};
+    const auto output{myDataset.column(myOutputColumn)};
+
+    copyColumn(input, myRow, count, buffer.input.data());
+    copyColumn(output, myRow, count, buffer.output.data());
+    releasePages(input, myRow, count);
+    releasePages(output, myRow, count);
+    myRow += count;
+    return count;
+}
+} // namespace host
+} // namespace ml
@@ -0,0 +1,225 @@
+/**
+ * @brief Implementation details of the memory-mapped columnar dataset (host build only).
+ */
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ml/host/dataset.h"
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+              "Dataset files are only supported on little endian hosts!");
+
+namespace ml
+{
+namespace host
+{
+namespace
+{
+/**
+ * @brief Structure holding dataset file parameters.
+ */
+struct FileParam
+{
+    /** Magic bytes at the start of every dataset file. */
+    static constexpr char Magic[4U]{'L', 'R', 'D', 'S'};
+
+    /** Current file format version. */
+    static constexpr uint16_t Version{1U};
+
+    /** Alignment of each column block in bytes. */
+    static constexpr size_t Alignment{8U};
+};
+
+// -----------------------------------------------------------------------------
+constexpr size_t align(const size_t offset) noexcept
+{
+    return (offset + FileParam::Alignment - 1U) & ~(FileParam::Alignment - 1U);
+}
+
+// -----------------------------------------------------------------------------
+constexpr size_t valueSize(const ColumnType type) noexcept
+{
+    return ColumnType::Float32 == type ? sizeof(float) :
+           ColumnType::Float64 == type ? sizeof(double) : 0U;
+}
+} // namespace
+
+/**
+ * @brief Dataset file header.
+ */
+struct Dataset::Header
+{
+    char magic[4U];        // Magic bytes, "LRDS".
+    uint16_t version;      // File format version.
+    uint16_t columnCount;  // The number of columns.
+    uint64_t rowCount;     // The number of rows.
+    uint8_t reserved[16U]; // Reserved for future use, set to 0.
+};
+
+/**
+ * @brief Dataset column descriptor.
+ */
+struct Dataset::Descriptor
+{
+    uint8_t type;         // Column type, see ColumnType.
+    uint8_t reserved[7U]; // Reserved for future use, set to 0.
+    uint64_t offset;      // Byte offset of the column data from the start of the file.
+};
+
+// -----------------------------------------------------------------------------
+Dataset::~Dataset() noexcept { close(); }
+
+// -----------------------------------------------------------------------------
+bool Dataset::open(const char* path) noexcept
+{
+    close();
+    if (nullptr == path) { return false; }
+
+    const auto fd{::open(path, O_RDONLY)};
+    if (0 > fd) { return false; }
+
+    // Map the entire file, the mapping stays valid after the file descriptor is closed.
+    struct stat status{};
+    void* data{MAP_FAILED};
+    if ((0 == fstat(fd, &status)) && (0 < status.st_size))
+    {
+        data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (MAP_FAILED == data) { return false; }
+
+    // Training reads the columns front to back, let the kernel read ahead aggressively.
+    (void) madvise(data, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+
+    myData     = static_cast<const uint8_t*>(data);
+    myFileSize = static_cast<size_t>(status.st_size);
+    if (!validate())
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Dataset::close() noexcept
+{
+    if (nullptr != myData) { (void) munmap(const_cast<uint8_t*>(myData), myFileSize); }
+    myData        = nullptr;
+    myFileSize    = 0U;
+    myDescriptors = nullptr;
+    myRowCount    = 0U;
+    myColumnCount = 0U;
+}
+
+// -----------------------------------------------------------------------------
+bool Dataset::isOpen() const noexcept { return nullptr != myData; }
+
+// -----------------------------------------------------------------------------
+size_t Dataset::rowCount() const noexcept { return myRowCount; }
+
+// -----------------------------------------------------------------------------
+size_t Dataset::columnCount() const noexcept { return myColumnCount; }
+
+// -----------------------------------------------------------------------------
+ColumnView Dataset::column(const size_t index) const noexcept
+{
+    if (index >= myColumnCount) { return ColumnView{nullptr, 0U, ColumnType::Count}; }
+    const auto& descriptor{myDescriptors[index]};
+    return ColumnView{myData + descriptor.offset, myRowCount, static_cast<ColumnType>(descriptor.type)};
+}
+
+// -----------------------------------------------------------------------------
+bool Dataset::write(const char* path, const ColumnView* columns, const size_t columnCount) noexcept
+{
+    if ((nullptr == path) || (nullptr == columns) || (0U == columnCount) ||
+        (UINT16_MAX < columnCount))
+    {
+        return false;
+    }
+
+    // Make sure every column is valid and holds the same number of values.
+    const auto rowCount{columns[0U].size};
+    for (size_t i{}; i < columnCount; ++i)
+    {
+        if ((0U == valueSize(columns[i].type)) || (rowCount != columns[i].size) ||
+            ((nullptr == columns[i].data) && (0U < rowCount)))
+        {
+            return false;
+        }
+    }
+
+    auto file{fopen(path, "wb")};
+    if (nullptr == file) { return false; }
+
+    Header header{};
+    memcpy(header.magic, FileParam::Magic, sizeof(header.magic));
+    header.version     = FileParam::Version;
+    header.columnCount = static_cast<uint16_t>(columnCount);
+    header.rowCount    = rowCount;
+    auto success{1U == fwrite(&header, sizeof(header), 1U, file)};
+
+    // Write the descriptors, each column block starts at the next aligned offset.
+    auto offset{align(sizeof(Header) + columnCount * sizeof(Descriptor))};
+    for (size_t i{}; success && (i < columnCount); ++i)
+    {
+        Descriptor descriptor{};
+        descriptor.type   = static_cast<uint8_t>(columns[i].type);
+        descriptor.offset = offset;
+        success = 1U == fwrite(&descriptor, sizeof(descriptor), 1U, file);
+        offset  = align(offset + rowCount * valueSize(columns[i].type));
+    }
+
+    // Write the column blocks, zero-pad between them to keep the alignment.
+    constexpr uint8_t padding[FileParam::Alignment]{};
+    for (size_t i{}; success && (i < columnCount); ++i)
+    {
+        const auto position{static_cast<size_t>(ftell(file))};
+        const auto paddingSize{align(position) - position};
+        const auto blockSize{rowCount * valueSize(columns[i].type)};
+        success = (paddingSize == fwrite(padding, 1U, paddingSize, file)) &&
+                  (blockSize == fwrite(columns[i].data, 1U, blockSize, file));
+    }
+    return (0 == fclose(file)) && success;
+}
+
+// -----------------------------------------------------------------------------
+bool Dataset::validate() noexcept
+{
+    static_assert(sizeof(Header) == 32U, "Unexpected dataset header size!");
+    static_assert(sizeof(Descriptor) == 16U, "Unexpected dataset descriptor size!");
+
+    // Check the header.
+    if (sizeof(Header) > myFileSize) { return false; }
+    const auto header{reinterpret_cast<const Header*>(myData)};
+    if ((0 != memcmp(header->magic, FileParam::Magic, sizeof(header->magic))) ||
+        (FileParam::Version != header->version) || (0U == header->columnCount))
+    {
+        return false;
+    }
+
+    // Check that the descriptors and every column block fit within the file.
+    if (sizeof(Header) + header->columnCount * sizeof(Descriptor) > myFileSize) { return false; }
+    const auto descriptors{reinterpret_cast<const Descriptor*>(myData + sizeof(Header))};
+
+    for (size_t i{}; i < header->columnCount; ++i)
+    {
+        const auto size{valueSize(static_cast<ColumnType>(descriptors[i].type))};
+        const auto offset{descriptors[i].offset};
+        if ((0U == size) || (0U != offset % FileParam::Alignment) || (offset > myFileSize) ||
+            (header->rowCount > (myFileSize - offset) / size))
+        {
+            return false;
+        }
+    }
+    myDescriptors = descriptors;
+    myRowCount    = header->rowCount;
+    myColumnCount = header->columnCount;
+    return true;
+}
+} // namespace host
+} // namespace ml
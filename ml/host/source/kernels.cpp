@@ -0,0 +1,311 @@
+/**
+ * @brief Implementation details of the vectorized batch kernels (host build only).
+ */
+#if !defined(ML_HOST_KERNELS_SCALAR) && defined(__GNUC__) && \
+    (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define ML_HOST_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+#include <float.h>
+
+#include "ml/host/kernels.h"
+
+namespace ml
+{
+namespace host
+{
+namespace kernels
+{
+namespace
+{
+/**
+ * @brief Structure holding the kernels selected for the running CPU.
+ */
+struct Dispatch
+{
+    /** Batch prediction kernel. */
+    void (*predict)(const double*, double*, const size_t, const double, const double) noexcept;
+
+    /** Sum of squared errors kernel. */
+    double (*sumSquaredError)(const double*, const double*, const size_t,
+                              const double, const double) noexcept;
+
+    /** Gradient sum kernel. */
+    GradientSums (*gradientSums)(const double*, const double*, const size_t,
+                                 const double, const double) noexcept;
+
+    /** Name of the associated instruction set. */
+    const char* name;
+};
+
+// -----------------------------------------------------------------------------
+inline double dabs(const double x) noexcept { return x < 0.0 ? -x : x; }
+
+// -----------------------------------------------------------------------------
+inline bool isFinite(const double x) noexcept 
+{ 
+    // NaN fails every ordered comparison, infinity exceeds the largest finite value.
+    return dabs(x) <= DBL_MAX; 
+}
+
+// -----------------------------------------------------------------------------
+void predictScalar(const double* input, double* output, const size_t count,
+                   const double weight, const double bias) noexcept
+{
+    for (size_t i{}; i < count; ++i) { output[i] = weight * input[i] + bias; }
+}
+
+// -----------------------------------------------------------------------------
+double sumSquaredErrorScalar(const double* input, const double* reference, const size_t count,
+                             const double weight, const double bias) noexcept
+{
+    double sum{};
+    for (size_t i{}; i < count; ++i)
+    {
+        const auto e{reference[i] - (weight * input[i] + bias)};
+        sum += e * e;
+    }
+    return sum;
+}
+
+// -----------------------------------------------------------------------------
+GradientSums gradientSumsScalar(const double* input, const double* reference, const size_t count,
+                                const double weight, const double bias) noexcept
+{
+    GradientSums sums{};
+    for (size_t i{}; i < count; ++i)
+    {
+        // e = yref - ypred.
+        const auto e{reference[i] - (weight * input[i] + bias)};
+        sums.errorSum         += e;
+        sums.weightedErrorSum += e * input[i];
+        sums.squaredErrorSum  += e * e;
+        if (!isFinite(e)) { sums.nonFinite = true; }
+        else if (sums.maxAbsError < dabs(e)) { sums.maxAbsError = dabs(e); }
+    }
+    return sums;
+}
+
+#ifdef ML_HOST_KERNELS_X86
+// -----------------------------------------------------------------------------
+void predictSse2(const double* input, double* output, const size_t count,
+                 const double weight, const double bias) noexcept
+{
+    const auto k{_mm_set1_pd(weight)};
+    const auto m{_mm_set1_pd(bias)};
+    size_t i{};
+
+    for (; i + 2U <= count; i += 2U)
+    {
+        _mm_storeu_pd(output + i, _mm_add_pd(_mm_mul_pd(k, _mm_loadu_pd(input + i)), m));
+    }
+    predictScalar(input + i, output + i, count - i, weight, bias);
+}
+
+// -----------------------------------------------------------------------------
+double sumSquaredErrorSse2(const double* input, const double* reference, const size_t count,
+                           const double weight, const double bias) noexcept
+{
+    const auto k{_mm_set1_pd(weight)};
+    const auto m{_mm_set1_pd(bias)};
+    auto sum{_mm_setzero_pd()};
+    size_t i{};
+
+    for (; i + 2U <= count; i += 2U)
+    {
+        const auto e{_mm_sub_pd(_mm_loadu_pd(reference + i),
+                                _mm_add_pd(_mm_mul_pd(k, _mm_loadu_pd(input + i)), m))};
+        sum = _mm_add_pd(sum, _mm_mul_pd(e, e));
+    }
+
+    double lanes[2U];
+    _mm_storeu_pd(lanes, sum);
+    return lanes[0U] + lanes[1U] 
+        + sumSquaredErrorScalar(input + i, reference + i, count - i, weight, bias);
+}
+
+// -----------------------------------------------------------------------------
+GradientSums gradientSumsSse2(const double* input, const double* reference, const size_t count,
+                              const double weight, const double bias) noexcept
+{
+    const auto k{_mm_set1_pd(weight)};
+    const auto m{_mm_set1_pd(bias)};
+    const auto absMask{_mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL))};
+    const auto finiteMax{_mm_set1_pd(DBL_MAX)};
+    auto errorSum{_mm_setzero_pd()}, weightedErrorSum{_mm_setzero_pd()};
+    auto squaredErrorSum{_mm_setzero_pd()}, maxAbsError{_mm_setzero_pd()};
+    auto nonFinite{_mm_setzero_pd()};
+    size_t i{};
+
+    for (; i + 2U <= count; i += 2U)
+    {
+        const auto x{_mm_loadu_pd(input + i)};
+        const auto e{_mm_sub_pd(_mm_loadu_pd(reference + i), _mm_add_pd(_mm_mul_pd(k, x), m))};
+        errorSum         = _mm_add_pd(errorSum, e);
+        weightedErrorSum = _mm_add_pd(weightedErrorSum, _mm_mul_pd(e, x));
+        squaredErrorSum  = _mm_add_pd(squaredErrorSum, _mm_mul_pd(e, e));
+        const auto absError{_mm_and_pd(e, absMask)};
+        maxAbsError      = _mm_max_pd(maxAbsError, absError);
+
+        // _mm_max_pd drops NaN, hence flag errors that aren't <= DBL_MAX (NaN or infinity).
+        nonFinite        = _mm_or_pd(nonFinite, _mm_cmpnle_pd(absError, finiteMax));
+    }
+
+    // Reduce the lanes, then add the remaining elements.
+    double lanes[4U][2U];
+    _mm_storeu_pd(lanes[0U], errorSum);
+    _mm_storeu_pd(lanes[1U], weightedErrorSum);
+    _mm_storeu_pd(lanes[2U], squaredErrorSum);
+    _mm_storeu_pd(lanes[3U], maxAbsError);
+    auto sums{gradientSumsScalar(input + i, reference + i, count - i, weight, bias)};
+    sums.errorSum         += lanes[0U][0U] + lanes[0U][1U];
+    sums.weightedErrorSum += lanes[1U][0U] + lanes[1U][1U];
+    sums.squaredErrorSum  += lanes[2U][0U] + lanes[2U][1U];
+    for (const auto lane : lanes[3U])
+    {
+        if (sums.maxAbsError < lane) { sums.maxAbsError = lane; }
+    }
+    if (_mm_movemask_pd(nonFinite) != 0) { sums.nonFinite = true; }
+    return sums;
+}
+
+// -----------------------------------------------------------------------------
+__attribute__((target("avx2")))
+void predictAvx2(const double* input, double* output, const size_t count,
+                 const double weight, const double bias) noexcept
+{
+    const auto k{_mm256_set1_pd(weight)};
+    const auto m{_mm256_set1_pd(bias)};
+    size_t i{};
+
+    for (; i + 4U <= count; i += 4U)
+    {
+        _mm256_storeu_pd(output + i, _mm256_add_pd(_mm256_mul_pd(k, _mm256_loadu_pd(input + i)), m));
+    }
+    predictScalar(input + i, output + i, count - i, weight, bias);
+}
+
+// -----------------------------------------------------------------------------
+__attribute__((target("avx2")))
+double sumSquaredErrorAvx2(const double* input, const double* reference, const size_t count,
+                           const double weight, const double bias) noexcept
+{
+    const auto k{_mm256_set1_pd(weight)};
+    const auto m{_mm256_set1_pd(bias)};
+    auto sum{_mm256_setzero_pd()};
+    size_t i{};
+
+    for (; i + 4U <= count; i += 4U)
+    {
+        const auto e{_mm256_sub_pd(_mm256_loadu_pd(reference + i),
+                                   _mm256_add_pd(_mm256_mul_pd(k, _mm256_loadu_pd(input + i)), m))};
+        sum = _mm256_add_pd(sum, _mm256_mul_pd(e, e));
+    }
+
+    double lanes[4U];
+    _mm256_storeu_pd(lanes, sum);
+    return (lanes[0U] + lanes[1U]) + (lanes[2U] + lanes[3U])
+        + sumSquaredErrorScalar(input + i, reference + i, count - i, weight, bias);
+}
+
+// -----------------------------------------------------------------------------
+__attribute__((target("avx2")))
+GradientSums gradientSumsAvx2(const double* input, const double* reference, const size_t count,
+                              const double weight, const double bias) noexcept
+{
+    const auto k{_mm256_set1_pd(weight)};
+    const auto m{_mm256_set1_pd(bias)};
+    const auto absMask{_mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL))};
+    const auto finiteMax{_mm256_set1_pd(DBL_MAX)};
+    auto errorSum{_mm256_setzero_pd()}, weightedErrorSum{_mm256_setzero_pd()};
+    auto squaredErrorSum{_mm256_setzero_pd()}, maxAbsError{_mm256_setzero_pd()};
+    auto nonFinite{_mm256_setzero_pd()};
+    size_t i{};
+
+    for (; i + 4U <= count; i += 4U)
+    {
+        const auto x{_mm256_loadu_pd(input + i)};
+        const auto e{_mm256_sub_pd(_mm256_loadu_pd(reference + i),
+                                   _mm256_add_pd(_mm256_mul_pd(k, x), m))};
+        errorSum         = _mm256_add_pd(errorSum, e);
+        weightedErrorSum = _mm256_add_pd(weightedErrorSum, _mm256_mul_pd(e, x));
+        squaredErrorSum  = _mm256_add_pd(squaredErrorSum, _mm256_mul_pd(e, e));
+        const auto absError{_mm256_and_pd(e, absMask)};
+        maxAbsError      = _mm256_max_pd(maxAbsError, absError);
+
+        // _mm256_max_pd drops NaN, hence flag errors that aren't <= DBL_MAX (NaN or infinity).
+        nonFinite        = _mm256_or_pd(nonFinite, 
+                                        _mm256_cmp_pd(absError, finiteMax, _CMP_NLE_UQ));
+    }
+
+    // Reduce the lanes, then add the remaining elements.
+    double lanes[4U][4U];
+    _mm256_storeu_pd(lanes[0U], errorSum);
+    _mm256_storeu_pd(lanes[1U], weightedErrorSum);
+    _mm256_storeu_pd(lanes[2U], squaredErrorSum);
+    _mm256_storeu_pd(lanes[3U], maxAbsError);
+    auto sums{gradientSumsScalar(input + i, reference + i, count - i, weight, bias)};
+    sums.errorSum         += (lanes[0U][0U] + lanes[0U][1U]) + (lanes[0U][2U] + lanes[0U][3U]);
+    sums.weightedErrorSum += (lanes[1U][0U] + lanes[1U][1U]) + (lanes[1U][2U] + lanes[1U][3U]);
+    sums.squaredErrorSum  += (lanes[2U][0U] + lanes[2U][1U]) + (lanes[2U][2U] + lanes[2U][3U]);
+    for (const auto lane : lanes[3U])
+    {
+        if (sums.maxAbsError < lane) { sums.maxAbsError = lane; }
+    }
+    if (_mm256_movemask_pd(nonFinite) != 0) { sums.nonFinite = true; }
+    return sums;
+}
+#endif // ML_HOST_KERNELS_X86
+
+// -----------------------------------------------------------------------------
+Dispatch selectKernels() noexcept
+{
+#ifdef ML_HOST_KERNELS_X86
+    // Use the widest instruction set supported by the running CPU.
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) 
+    { 
+        return Dispatch{predictAvx2, sumSquaredErrorAvx2, gradientSumsAvx2, "avx2"}; 
+    }
+    return Dispatch{predictSse2, sumSquaredErrorSse2, gradientSumsSse2, "sse2"};
+#else
+    return Dispatch{predictScalar, sumSquaredErrorScalar, gradientSumsScalar, "scalar"};
+#endif
+}
+
+// -----------------------------------------------------------------------------
+const Dispatch& selected() noexcept
+{
+    // Select the kernels once only.
+    static const Dispatch dispatch{selectKernels()};
+    return dispatch;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+void predict(const double* input, double* output, const size_t count,
+             const double weight, const double bias) noexcept
+{
+    selected().predict(input, output, count, weight, bias);
+}
+
+// -----------------------------------------------------------------------------
+double sumSquaredError(const double* input, const double* reference, const size_t count,
+                       const double weight, const double bias) noexcept
+{
+    return selected().sumSquaredError(input, reference, count, weight, bias);
+}
+
+// -----------------------------------------------------------------------------
+GradientSums gradientSums(const double* input, const double* reference, const size_t count,
+                          const double weight, const double bias) noexcept
+{
+    return selected().gradientSums(input, reference, count, weight, bias);
+}
+
+// -----------------------------------------------------------------------------
+const char* instructionSet() noexcept { return selected().name; }
+} // namespace kernels
+} // namespace host
+} // namespace ml
@@ -0,0 +1,266 @@
+/**
+ * @brief Implementation details of the data-parallel batch trainer (host build only).
+ */
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "ml/host/kernels.h"
+#include "ml/host/parallel_trainer.h"
+
+namespace ml
+{
+namespace host
+{
+namespace
+{
+/** Assumed size of a cache line in bytes, used to avoid false sharing between threads. */
+constexpr size_t CacheLineSize{64U};
+
+// -----------------------------------------------------------------------------
+unsigned resolveThreadCount(const unsigned requested, const size_t setCount) noexcept
+{
+    // Use one thread per available core unless a specific number of threads is requested.
+    auto threadCount{0U < requested ? requested : std::thread::hardware_concurrency()};
+    if (0U == threadCount) { threadCount = 1U; }
+
+    // Never use more threads than there are training sets.
+    if (setCount < threadCount) { threadCount = 0U < setCount ? static_cast<unsigned>(setCount) : 1U; }
+    return threadCount;
+}
+
+/**
+ * @brief One-shot gate holding the worker threads until every thread has been created.
+ *
+ *        If a thread can't be created, the gate is opened with a cancel request, so that the
+ *        threads already created return instead of waiting forever at the epoch barrier.
+ */
+class StartGate final
+{
+public:
+    /**
+     * @brief Open the gate and release the waiting threads.
+     *
+     * @param[in] run True to let the threads run, false to cancel them.
+     */
+    void open(const bool run) noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock{myMutex};
+            myRun  = run;
+            myOpen = true;
+        }
+        myCondition.notify_all();
+    }
+
+    /**
+     * @brief Block the calling thread until the gate is opened.
+     *
+     * @return True if the thread shall run, false if it has been cancelled.
+     */
+    bool wait() noexcept
+    {
+        std::unique_lock<std::mutex> lock{myMutex};
+        myCondition.wait(lock, [&] { return myOpen; });
+        return myRun;
+    }
+
+private:
+    std::mutex myMutex{};
+    std::condition_variable myCondition{};
+    bool myOpen{};
+    bool myRun{};
+};
+} // namespace
+
+/**
+ * @brief Gradient partial sums of a single worker thread.
+ *
+ *        Each instance occupies its own cache line so that threads never write to the same line.
+ */
+struct alignas(CacheLineSize) ParallelTrainer::Partial
+{
+    /** The gradient partial sums. */
+    kernels::GradientSums sums;
+};
+
+/**
+ * @brief Reusable barrier used to synchronize the worker threads between epochs.
+ */
+class ParallelTrainer::Barrier final
+{
+public:
+    /**
+     * @brief Create barrier for given number of threads.
+     *
+     * @param[in] threadCount The number of threads to synchronize.
+     */
+    explicit Barrier(const unsigned threadCount) noexcept
+        : myThreadCount{threadCount} {}
+
+    /**
+     * @brief Block the calling thread until every thread has reached the barrier.
+     */
+    void wait() noexcept
+    {
+        std::unique_lock<std::mutex> lock{myMutex};
+        const auto generation{myGeneration};
+
+        // Release the other threads if this is the last thread to arrive, else wait for it.
+        if (++myArrivedCount == myThreadCount)
+        {
+            myArrivedCount = 0U;
+            ++myGeneration;
+            myCondition.notify_all();
+        }
+        else { myCondition.wait(lock, [&] { return generation != myGeneration; }); }
+    }
+
+private:
+    std::mutex myMutex{};
+    std::condition_variable myCondition{};
+    const unsigned myThreadCount;
+    unsigned myArrivedCount{};
+    unsigned myGeneration{};
+};
+
+// -----------------------------------------------------------------------------
+ParallelTrainer::ParallelTrainer(const double* trainInput, const double* trainOutput,
+                                 const size_t setCount, const unsigned threadCount) noexcept
+    : myTrainInput{trainInput}
+    , myTrainOutput{trainOutput}
+    , mySetCount{(nullptr != trainInput) && (nullptr != trainOutput) ? setCount : 0U}
+    , myThreadCount{resolveThreadCount(threadCount, mySetCount)} {}
+
+// -----------------------------------------------------------------------------
+ParallelTrainer::ParallelTrainer(const container::Span<const double> trainInput,
+                                 const container::Span<const double> trainOutput,
+                                 const unsigned threadCount) noexcept
+    : ParallelTrainer{trainInput.data(), trainOutput.data(),
+                      trainInput.size() <= trainOutput.size() ? trainInput.size() : trainOutput.size(),
+                      threadCount} {}
+
+// -----------------------------------------------------------------------------
+double ParallelTrainer::predict(const double input) const noexcept
+{
+    return myWeight * input + myBias;
+}
+
+// -----------------------------------------------------------------------------
+bool ParallelTrainer::train(const double learningRate, const size_t maxEpochs,
+                            const double tolerance) noexcept
+{
+    if ((0.0 >= learningRate) || (0U == mySetCount) || (0U == maxEpochs)) { return false; }
+
+    // Allocate every buffer up front, report failure rather than letting bad_alloc escape.
+    std::vector<Partial> partials{};
+    std::vector<std::thread> threads{};
+    try
+    {
+        partials.resize(myThreadCount);
+        threads.reserve(myThreadCount - 1U);
+    }
+    catch (const std::bad_alloc&) { return false; }
+
+    Barrier barrier{myThreadCount};
+    StartGate gate{};
+    auto converged{false};
+    auto done{false};
+    myEpochsUsed = 0;
+
+    // Worker routine, thread 0 also reduces the partial sums and updates the model.
+    auto work{[&](const unsigned index)
+    {
+        // Split the training sets evenly, the first threads take one extra set each if needed.
+        const auto baseCount{mySetCount / myThreadCount};
+        const auto remainder{mySetCount % myThreadCount};
+        const auto begin{index * baseCount + (index < remainder ? index : remainder)};
+        const auto end{begin + baseCount + (index < remainder ? 1U : 0U)};
+
+        // Wait until every worker thread has been created.
+        if ((0U != index) && !gate.wait()) { return; }
+
+        while (true)
+        {
+            accumulate(partials[index], begin, end);
+            barrier.wait();
+
+            if (0U == index)
+            {
+                // Reduce the partial sums in thread order to keep the result deterministic.
+                kernels::GradientSums total{};
+                for (const auto& partial : partials)
+                {
+                    total.errorSum         += partial.sums.errorSum;
+                    total.weightedErrorSum += partial.sums.weightedErrorSum;
+                    total.squaredErrorSum  += partial.sums.squaredErrorSum;
+                    total.nonFinite         = total.nonFinite || partial.sums.nonFinite;
+                    if (total.maxAbsError < partial.sums.maxAbsError) 
+                    { 
+                        total.maxAbsError = partial.sums.maxAbsError; 
+                    }
+                }
+                const auto n{static_cast<double>(mySetCount)};
+                myMeanSquaredError = total.squaredErrorSum / n;
+                ++myEpochsUsed;
+
+                // Stop if the model has diverged, since maxAbsError is meaningless then.
+                if (total.nonFinite || !std::isfinite(myMeanSquaredError)) { done = true; }
+
+                // Stop if every prediction is within tolerance, else take a gradient step.
+                else if (total.maxAbsError <= tolerance) { converged = true; }
+                else
+                {
+                    myBias   += learningRate * total.errorSum / n;
+                    myWeight += learningRate * total.weightedErrorSum / n;
+                }
+                done = done || converged || (static_cast<size_t>(myEpochsUsed) >= maxEpochs);
+            }
+            barrier.wait();
+            if (done) { break; }
+        }
+    }};
+
+    // Run worker 0 in the calling thread, the others in separate threads.
+    auto created{true};
+    for (unsigned i{1U}; i < myThreadCount; ++i)
+    {
+        try { threads.emplace_back(work, i); }
+        catch (const std::system_error&) { created = false; break; }
+    }
+
+    // Cancel the threads already created if any thread couldn't be created.
+    gate.open(created);
+    if (created) { work(0U); }
+    for (auto& thread : threads) { thread.join(); }
+    return created && converged;
+}
+
+// -----------------------------------------------------------------------------
+int ParallelTrainer::getEpochsUsed() const noexcept { return myEpochsUsed; }
+
+// -----------------------------------------------------------------------------
+double ParallelTrainer::getBias() const noexcept { return myBias; }
+
+// -----------------------------------------------------------------------------
+double ParallelTrainer::getWeight() const noexcept { return myWeight; }
+
+// -----------------------------------------------------------------------------
+double ParallelTrainer::meanSquaredError() const noexcept { return myMeanSquaredError; }
+
+// -----------------------------------------------------------------------------
+unsigned ParallelTrainer::threadCount() const noexcept { return myThreadCount; }
+
+// -----------------------------------------------------------------------------
+void ParallelTrainer::accumulate(Partial& partial, const size_t begin, const size_t end) const noexcept
+{
+    // Use the vectorized kernel, write the slot once to keep the cache line exclusive.
+    partial.sums = kernels::gradientSums(myTrainInput + begin, myTrainOutput + begin, 
+                                         end - begin, myWeight, myBias);
+}
+} // namespace host
+} // namespace ml
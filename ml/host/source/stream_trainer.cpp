@@ -0,0 +1,107 @@
+/**
+ * @brief Implementation details of the out-of-core trainer (host build only).
+ */
+#include <math.h>
+
+#include "ml/host/chunk_reader.h"
+#include "ml/host/kernels.h"
+#include "ml/host/stream_trainer.h"
+
+namespace ml
+{
+namespace host
+{
+// -----------------------------------------------------------------------------
+double StreamTrainer::predict(const double input) const noexcept
+{
+    return myWeight * input + myBias;
+}
+
+// -----------------------------------------------------------------------------
+bool StreamTrainer::trainMiniBatch(ChunkReader& reader, const double learningRate,
+                                   const size_t epochs) noexcept
+{
+    if ((0.0 >= learningRate) || (0U == epochs) || !reader.isOpen()) { return false; }
+    myEpochsUsed = 0;
+
+    for (size_t epoch{}; epoch < epochs; ++epoch)
+    {
+        if (!reader.rewind()) { return false; }
+        double sse{};
+        size_t count{};
+        Chunk chunk{};
+
+        // Take one gradient step per chunk, using the mean gradient of the chunk.
+        while (reader.next(chunk))
+        {
+            const auto sums{kernels::gradientSums(chunk.input, chunk.output, chunk.size,
+                                                  myWeight, myBias)};
+            if (sums.nonFinite) { return false; }
+            const auto n{static_cast<double>(chunk.size)};
+            myBias   += learningRate * sums.errorSum / n;
+            myWeight += learningRate * sums.weightedErrorSum / n;
+            sse      += sums.squaredErrorSum;
+            count    += chunk.size;
+        }
+        if (0U == count) { return false; }
+        myMeanSquaredError = sse / static_cast<double>(count);
+        ++myEpochsUsed;
+
+        // Stop if the model has diverged.
+        if (!isfinite(myMeanSquaredError)) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool StreamTrainer::trainOnline(ChunkReader& reader, const double learningRate,
+                                const size_t epochs) noexcept
+{
+    if ((0.0 >= learningRate) || (0U == epochs) || !reader.isOpen()) { return false; }
+    myEpochsUsed = 0;
+
+    for (size_t epoch{}; epoch < epochs; ++epoch)
+    {
+        if (!reader.rewind()) { return false; }
+        double sse{};
+        size_t count{};
+        Chunk chunk{};
+
+        // Take one gradient step per sample.
+        while (reader.next(chunk))
+        {
+            for (size_t i{}; i < chunk.size; ++i)
+            {
+                // e = yref - ypred.
+                const auto e{chunk.output[i] - predict(chunk.input[i])};
+
+                // m = m + e * LR, k = k + e * LR * x.
+                myBias   += e * learningRate;
+                myWeight += e * learningRate * chunk.input[i];
+                sse      += e * e;
+            }
+            count += chunk.size;
+        }
+        if (0U == count) { return false; }
+        myMeanSquaredError = sse / static_cast<double>(count);
+        ++myEpochsUsed;
+
+        // Stop if the model has diverged.
+        if (!isfinite(myMeanSquaredError)) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+int StreamTrainer::getEpochsUsed() const noexcept { return myEpochsUsed; }
+
+// -----------------------------------------------------------------------------
+double StreamTrainer::getBias() const noexcept { return myBias; }
+
+// -----------------------------------------------------------------------------
+double StreamTrainer::getWeight() const noexcept { return myWeight; }
+
+// -----------------------------------------------------------------------------
+double StreamTrainer::meanSquaredError() const noexcept { return myMeanSquaredError; }
+} // namespace host
+} // namespace ml
@@ -0,0 +1,345 @@
+/**
+ * @brief Host tool training a linear regression model and exporting its coefficients as a
+ *        firmware header.
+ *
+ *        Usage: linreg_export <dataset> [-o <header>] [-r <learning rate>] [-e <max epochs>]
+ *                                       [-t <threads>] [--csv]
+ *
+ *        The dataset is a binary dataset file (see dataset.h), or a CSV file if --csv is given,
+ *        with the input values in column 0 and the output values in column 1. The generated
+ *        header is written to ml/include/ml/linreg/coefficients.h by default. When this header
+ *        exists, the firmware uses the exported coefficients and skips on-device training.
+ *
+ *        The header is only written if the training converged to finite coefficients that fit
+ *        the 32-bit fixed-point format, since the firmware includes it automatically and a bad
+ *        export would break the build.
+ */
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <new>
+#include <vector>
+
+#include "ml/host/chunk_reader.h"
+#include "ml/host/dataset.h"
+#include "ml/host/parallel_trainer.h"
+
+namespace
+{
+/**
+ * @brief Structure holding the tool options.
+ */
+struct Options
+{
+    /** Path to the dataset. */
+    const char* dataset{nullptr};
+
+    /** Path to the header to generate. */
+    const char* header{"ml/include/ml/linreg/coefficients.h"};
+
+    /** Learning rate to use. */
+    double learningRate{0.5};
+
+    /** Maximum number of epochs to use. */
+    size_t maxEpochs{100000U};
+
+    /** The number of worker threads (0 = one per core). */
+    unsigned threadCount{0U};
+
+    /** Indicate whether the dataset is a CSV file. */
+    bool csv{false};
+};
+
+/**
+ * @brief Fixed-point representation of the coefficients, value = raw / 2^fractionalBits.
+ */
+struct FixedPoint
+{
+    /** Weight in fixed-point format. */
+    int32_t weight;
+
+    /** Bias in fixed-point format. */
+    int32_t bias;
+
+    /** The number of fractional bits. */
+    uint8_t fractionalBits;
+};
+
+// -----------------------------------------------------------------------------
+bool parseUnsigned(const char* text, const unsigned long long max, 
+                   unsigned long long& value) noexcept
+{
+    // Reject signs, trailing characters and values that don't fit, e.g. "-1" or "8x".
+    if (('0' > text[0]) || ('9' < text[0])) { return false; }
+    char* end{nullptr};
+    errno = 0;
+    const auto result{strtoull(text, &end, 10)};
+    if ((0 != errno) || ('\0' != *end) || (max < result)) { return false; }
+    value = result;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool parseThreadCount(const char* text, unsigned& threadCount) noexcept
+{
+    unsigned long long value{};
+    if (!parseUnsigned(text, UINT_MAX, value)) { return false; }
+    threadCount = static_cast<unsigned>(value);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool parseMaxEpochs(const char* text, size_t& maxEpochs) noexcept
+{
+    // The trainer counts the epochs used as an int.
+    unsigned long long value{};
+    if (!parseUnsigned(text, INT_MAX, value) || (0U == value)) { return false; }
+    maxEpochs = static_cast<size_t>(value);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool parseLearningRate(const char* text, double& learningRate) noexcept
+{
+    // Reject empty and trailing characters as well as non-positive and non-finite rates.
+    char* end{nullptr};
+    errno = 0;
+    const auto value{strtod(text, &end)};
+    if ((0 != errno) || (end == text) || ('\0' != *end) || !isfinite(value) || (0.0 >= value))
+    {
+        return false;
+    }
+    learningRate = value;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool parseOptions(const int argc, char** argv, Options& options) noexcept
+{
+    for (int i{1}; i < argc; ++i)
+    {
+        const auto hasValue{i + 1 < argc};
+        if (0 == strcmp(argv[i], "--csv")) { options.csv = true; }
+        else if ((0 == strcmp(argv[i], "-o")) && hasValue) { options.header = argv[++i]; }
+        else if ((0 == strcmp(argv[i], "-r")) && hasValue)
+        {
+            if (!parseLearningRate(argv[++i], options.learningRate)) { return false; }
+        }
+        else if ((0 == strcmp(argv[i], "-e")) && hasValue)
+        {
+            if (!parseMaxEpochs(argv[++i], options.maxEpochs)) { return false; }
+        }
+        else if ((0 == strcmp(argv[i], "-t")) && hasValue) 
+        { 
+            if (!parseThreadCount(argv[++i], options.threadCount)) { return false; }
+        }
+        else if (('-' != argv[i][0]) && (nullptr == options.dataset)) { options.dataset = argv[i]; }
+        else { return false; }
+    }
+    return nullptr != options.dataset;
+}
+
+// -----------------------------------------------------------------------------
+bool loadCsv(const char* path, std::vector<double>& input, std::vector<double>& output) noexcept
+{
+    ml::host::ChunkReader reader{4096U};
+    if (!reader.open(path, ml::host::ChunkReader::Format::Csv)) { return false; }
+    ml::host::Chunk chunk{};
+
+    // The whole dataset is kept in memory for training, report failure if it doesn't fit.
+    try
+    {
+        while (reader.next(chunk))
+        {
+            input.insert(input.end(), chunk.input, chunk.input + chunk.size);
+            output.insert(output.end(), chunk.output, chunk.output + chunk.size);
+        }
+    }
+    catch (const std::bad_alloc&)
+    {
+        fprintf(stderr, "Not enough memory to load %s!\n", path);
+        return false;
+    }
+    return !input.empty();
+}
+
+// -----------------------------------------------------------------------------
+const double* columnAsDouble(const ml::host::ColumnView& column, std::vector<double>& storage) noexcept
+{
+    // Use double columns in place, convert float columns.
+    if (nullptr != column.asDouble()) { return column.asDouble(); }
+    if (nullptr == column.asFloat()) { return nullptr; }
+    try { storage.assign(column.asFloat(), column.asFloat() + column.size); }
+    catch (const std::bad_alloc&)
+    {
+        fprintf(stderr, "Not enough memory to convert a float column!\n");
+        return nullptr;
+    }
+    return storage.data();
+}
+
+// -----------------------------------------------------------------------------
+bool quantize(const double weight, const double bias, FixedPoint& fixedPoint) noexcept
+{
+    // Use as many fractional bits as possible while both coefficients round to 32 bits.
+    const auto largest{fabs(weight) > fabs(bias) ? fabs(weight) : fabs(bias)};
+    const auto limit{ldexp(1.0, 31) - 0.5};
+    uint8_t fractionalBits{30U};
+    while ((0U < fractionalBits) && (largest * ldexp(1.0, fractionalBits) >= limit))
+    {
+        --fractionalBits;
+    }
+
+    // The coefficients don't fit even without fractional bits, the conversion would overflow.
+    if (largest * ldexp(1.0, fractionalBits) >= limit) { return false; }
+    fixedPoint = FixedPoint{static_cast<int32_t>(lround(ldexp(weight, fractionalBits))),
+                            static_cast<int32_t>(lround(ldexp(bias, fractionalBits))),
+                            fractionalBits};
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool writeHeader(const Options& options, const ml::host::ParallelTrainer& model,
+                 const FixedPoint& fixedPoint, const size_t sampleCount) noexcept
+{
+    auto file{fopen(options.header, "w")};
+    if (nullptr == file) { return false; }
+
+    fprintf(file,
+        "/**\n"
+        " * @brief Linear regression coefficients trained on the host.\n"
+        " *\n"
+        " * @note This file is generated by linreg_export, don't edit it manually!\n"
+        " */\n"
+        "#pragma once\n"
+        "\n"
+        "#include <stdint.h>\n"
+        "\n"
+        "namespace ml\n"
+        "{\n"
+        "namespace linreg\n"
+        "{\n"
+        "namespace coefficients\n"
+        "{\n"
+        "/** Weight value of the model, (k) in the equation kx + m = y. */\n"
+        "constexpr double weight{%.17g};\n"
+        "\n"
+        "/** Bias value of the model, (m) in the equation kx + m = y. */\n"
+        "constexpr double bias{%.17g};\n"
+        "\n"
+        "/** The number of fractional bits of the fixed-point coefficients. */\n"
+        "constexpr uint8_t fractionalBits{%uU};\n"
+        "\n"
+        "/** Fixed-point scale, value = raw / scale. */\n"
+        "constexpr int32_t fixedPointScale{%ldL};\n"
+        "\n"
+        "/** Weight in fixed-point format. */\n"
+        "constexpr int32_t weightFixed{%ldL};\n"
+        "\n"
+        "/** Bias in fixed-point format. */\n"
+        "constexpr int32_t biasFixed{%ldL};\n"
+        "\n"
+        "/** The number of samples used for training. */\n"
+        "constexpr uint64_t sampleCount{%lluULL};\n"
+        "\n"
+        "/** The number of epochs used for training. */\n"
+        "constexpr int epochsUsed{%d};\n"
+        "\n"
+        "/** The learning rate used for training. */\n"
+        "constexpr double learningRate{%.17g};\n"
+        "\n"
+        "/** Mean squared error of the last training epoch. */\n"
+        "constexpr double meanSquaredError{%.17g};\n"
+        "} // namespace coefficients\n"
+        "} // namespace linreg\n"
+        "} // namespace ml\n",
+        model.getWeight(), model.getBias(), static_cast<unsigned>(fixedPoint.fractionalBits),
+        static_cast<long>(1L << fixedPoint.fractionalBits), static_cast<long>(fixedPoint.weight),
+        static_cast<long>(fixedPoint.bias), static_cast<unsigned long long>(sampleCount),
+        model.getEpochsUsed(), options.learningRate, model.meanSquaredError());
+    return 0 == fclose(file);
+}
+} // namespace
+
+/**
+ * @brief Train a linear regression model on given dataset and export its coefficients.
+ *
+ * @return 0 on success, 1 on failure, including if the training didn't converge.
+ */
+int main(int argc, char** argv)
+{
+    Options options{};
+    if (!parseOptions(argc, argv, options))
+    {
+        fprintf(stderr, "Usage: %s <dataset> [-o <header>] [-r <learning rate>] "
+                        "[-e <max epochs>] [-t <threads>] [--csv]\n", argv[0]);
+        return 1;
+    }
+
+    // Load the dataset, binary datasets are used in place.
+    ml::host::Dataset dataset{};
+    std::vector<double> inputStorage{}, outputStorage{};
+    const double* input{nullptr};
+    const double* output{nullptr};
+    size_t sampleCount{};
+
+    if (options.csv)
+    {
+        if (loadCsv(options.dataset, inputStorage, outputStorage))
+        {
+            input       = inputStorage.data();
+            output      = outputStorage.data();
+            sampleCount = inputStorage.size();
+        }
+    }
+    else if (dataset.open(options.dataset) && (2U <= dataset.columnCount()))
+    {
+        input       = columnAsDouble(dataset.column(0U), inputStorage);
+        output      = columnAsDouble(dataset.column(1U), outputStorage);
+        sampleCount = dataset.rowCount();
+    }
+
+    if ((nullptr == input) || (nullptr == output) || (0U == sampleCount))
+    {
+        fprintf(stderr, "Failed to load dataset %s!\n", options.dataset);
+        return 1;
+    }
+
+    // Train the model and export the coefficients.
+    ml::host::ParallelTrainer model{input, output, sampleCount, options.threadCount};
+    const auto converged{model.train(options.learningRate, options.maxEpochs)};
+    printf("Trained on %lu samples with %u threads: weight = %g, bias = %g, epochs = %d, mse = %g%s\n",
+           static_cast<unsigned long>(sampleCount), model.threadCount(), model.getWeight(),
+           model.getBias(), model.getEpochsUsed(), model.meanSquaredError(),
+           converged ? "" : " (not converged)");
+
+    // Never export a diverged or unconverged model, the firmware build includes the header.
+    if (!converged || !isfinite(model.getWeight()) || !isfinite(model.getBias()))
+    {
+        fprintf(stderr, "Training didn't converge to finite coefficients, %s not written!\n",
+                options.header);
+        return 1;
+    }
+
+    // Never export coefficients that don't fit the fixed-point format either.
+    FixedPoint fixedPoint{};
+    if (!quantize(model.getWeight(), model.getBias(), fixedPoint))
+    {
+        fprintf(stderr, "Coefficients exceed the 32-bit fixed-point range, %s not written!\n",
+                options.header);
+        return 1;
+    }
+
+    if (!writeHeader(options, model, fixedPoint, sampleCount))
+    {
+        fprintf(stderr, "Failed to write header %s!\n", options.header);
+        return 1;
+    }
+    printf("Coefficients written to %s\n", options.header);
+    return 0;
+}
@@ -1,6 +1,7 @@
 /**
  * @brief Interface for linear regression algorithms.
  */
+#pragma once
 
 namespace ml 
 { 
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "ml/linreg/interface.h"
+#include "container/small_vector.h"
+#include "container/span.h"
 #include "container/vector.h"
 
 namespace driver
@@ -27,13 +29,26 @@ public:
     /**
      * @brief Constructor LinReg.
      * 
-     * @param [in] trainInput Reference to a readble vector, (data that is going to be traded).
-     * @param [in] tainOutput Reference to a readble vector, (data that is going to be traded).
+     *        The training data is viewed, not copied, hence it can be held by any contiguous 
+     *        container (vector, static vector, array or C array) and must outlive the model.
+     * 
+     * @param [in] trainInput View of the training data (input data).
+     * @param [in] trainOutput View of the training data (output data).
      */
-    explicit LinReg(const container::Vector<double>& trainInput,
-                    const container::Vector<double>& trainOutput,
+    explicit LinReg(const container::Span<const double> trainInput,
+                    const container::Span<const double> trainOutput,
                     driver::SerialInterface& serial) noexcept;
 
+    /**
+     * @brief Constructor LinReg for training data stored in plain arrays.
+     * 
+     * @param [in] trainInput Pointer to the training data (input data).
+     * @param [in] trainOutput Pointer to the training data (output data).
+     * @param [in] trainSetCount The number of training sets.
+     */
+    explicit LinReg(const double* trainInput, const double* trainOutput, 
+                    const size_t trainSetCount, driver::SerialInterface& serial) noexcept;
+
     /**
      * @brief Delete the constructor as default.
      */
@@ -92,16 +107,16 @@ public:
 
 private:
 
-    const container::Vector<double>& myTrainInput;            // Reference to the training data (input data).
-    const container::Vector<double>& myTrainOutput;           // Reference to the training data (output data).
+    const double* myTrainInput;                         // Pointer to the training data (input data).
+    const double* myTrainOutput;                        // Pointer to the training data (output data).
     size_t myTrainSetCount;                        // Indicates the total of full trainingset that are avalible.
     double myBias;                                      // Bias value for the module, (m) in the ecvation kx + m = y.
     double myWeight;                                    // Weight value for the module, (k) in the ecvation kc + m = y.
     container::Vector<double> myLastPredict;                  // Reference to the last data the modlue has between epochs.
     int myEpochsUsed{0};                                // To save the amount of epochs that are used for the specific traingmodule.
-    container::Vector<double> myPredVector;                   // Last predict.
+    container::SmallVector<double, 16U> myPredErrors;         // Absolute prediction errors of the last epoch (inline for up to 16 training sets).
     size_t myEpochCount{0};                        // The specified amount of epochs that the module should use.   
-    container::Vector<size_t> myIndex;                   // Vector that holds the amount of indexes in traingvector to shuffle.
+    container::SmallVector<size_t, 16U> myIndex;         // Vector that holds the amount of indexes in traingvector to shuffle.
     driver::SerialInterface& mySerial;
 
 };
@@ -0,0 +1,86 @@
+/**
+ * @brief Linear regression model with coefficients trained ahead of time.
+ */
+#pragma once
+
+#include "ml/linreg/interface.h"
+
+namespace ml
+{
+namespace linreg
+{
+/**
+ * @brief Linear regression model with fixed coefficients, for instance generated by the
+ *        host tool linreg_export. No training is performed on the target.
+ *
+ * @note The class is final.
+ */
+class Pretrained final : public Interface
+{
+public:
+    /**
+     * @brief Create model with given coefficients.
+     *
+     * @param[in] weight The weight of the model, (k) in the equation kx + m = y.
+     * @param[in] bias The bias of the model, (m) in the equation kx + m = y.
+     * @param[in] epochsUsed The number of epochs used to train the model (default = 0).
+     */
+    constexpr explicit Pretrained(const double weight, const double bias,
+                                  const int epochsUsed = 0) noexcept
+        : myWeight{weight}
+        , myBias{bias}
+        , myEpochsUsed{epochsUsed} {}
+
+    /**
+     * @brief Delete the model.
+     */
+    ~Pretrained() noexcept override = default;
+
+    /**
+     * @brief Predict with the model.
+     *
+     * @param[in] input The input to predict with.
+     *
+     * @return The predicted value.
+     */
+    double predict(const double input) const noexcept override { return myWeight * input + myBias; }
+
+    /**
+     * @brief Get the number of epochs used to train the model.
+     *
+     * @return The number of epochs used.
+     */
+    int getEpochsUsed() const noexcept override { return myEpochsUsed; }
+
+    /**
+     * @brief Get the bias of the model.
+     *
+     * @return The bias of the model.
+     */
+    double getBias() const noexcept override { return myBias; }
+
+    /**
+     * @brief Get the weight of the model.
+     *
+     * @return The weight of the model.
+     */
+    double getWeight() const noexcept override { return myWeight; }
+
+    Pretrained()                             = delete; // No default constructor.
+    Pretrained(const Pretrained&)            = delete; // No copy constructor.
+    Pretrained(Pretrained&&)                 = delete; // No move constructor.
+    Pretrained& operator=(const Pretrained&) = delete; // No copy assignment.
+    Pretrained& operator=(Pretrained&&)      = delete; // No move assignment.
+
+private:
+    /** Weight value of the model, (k) in the equation kx + m = y. */
+    const double myWeight;
+
+    /** Bias value of the model, (m) in the equation kx + m = y. */
+    const double myBias;
+
+    /** The number of epochs used to train the model. */
+    const int myEpochsUsed;
+};
+} // namespace linreg
+} // namespace ml
@@ -4,6 +4,7 @@
 #include "driver/serial/interface.h"
 #include "ml/linreg/linreg.h"
 #include "driver/serial/interface.h"
+#include "container/algorithm.h"
 #include "container/vector.h"
 
 namespace ml
@@ -46,24 +47,20 @@ double randomStartVal() noexcept
 /**
  * @brief Shuffle the content of the given vector.
  * 
+ * @tparam Vector The vector type.
+ * 
  * @param[in, out] data Reference to the vector to shuffle.
  */
-void shuffle(container::Vector<size_t>& data) noexcept
+template <typename Vector>
+void shuffle(Vector& data) noexcept
 {
-    // Shuffle the vector by swapping each element with a random element.
-    for (size_t i{}; i < data.size(); ++i)
+    // Shuffle the vector via Fisher-Yates, i.e. swap each element with a random element
+    // at or before it, which makes every order equally likely.
+    for (size_t i{data.size()}; i > 1U; --i)
     {
-        // Get a random index r (between 0-4 if we have five training sets).
-        const auto r{rand() % data.size()};
-
-        // Swap the elements at index i and r => make a copy of data[i].
-        const auto temp{data[i]};
-
-        // Copy data[r] to data[i] => now we have two instances of data[r] in the vector.
-        data[i] = data[r];
-
-        // Finally put the copy of the "old" data[i] to data[r] => we have swapped the elements.
-        data[r] = temp;
+        // Get a random index r between 0 and i - 1.
+        const auto r{rand() % i};
+        utils::swap(data[i - 1U], data[r]);
     }
 }
 
@@ -88,13 +85,19 @@ constexpr size_t min(const size_t x, const size_t y) noexcept
 } // namespace
 
 //--------------------------------------------------------------------------------//
-LinReg::LinReg(const container::Vector<double>& trainInput,
-               const container::Vector<double>& trainOutput,
+LinReg::LinReg(const container::Span<const double> trainInput,
+               const container::Span<const double> trainOutput,
                driver::SerialInterface& serial) noexcept
+                :   LinReg{trainInput.data(), trainOutput.data(), 
+                           min(trainInput.size(), trainOutput.size()), serial} {}
+
+//--------------------------------------------------------------------------------//
+LinReg::LinReg(const double* trainInput, const double* trainOutput, 
+               const size_t trainSetCount, driver::SerialInterface& serial) noexcept
                 :   myTrainInput{trainInput},
                     myTrainOutput{trainOutput},  
-                    myTrainSetCount{min(trainInput.size(), trainOutput.size())},
-                    myPredVector(myTrainSetCount),
+                    myTrainSetCount{trainSetCount},
+                    myPredErrors(myTrainSetCount),
                     mySerial{serial}
 {
     mySerial.setEnabled(true);
@@ -148,11 +151,14 @@ bool LinReg::trainWithNoEpoch(double learningRate) noexcept
             // k = k + e * LR * x.
             myWeight = myWeight + (e * learningRate * myTrainInput[i]);
 
-            myPredVector[i] = predict(myTrainInput[i]);
-
             // ackumulera sse
             sse += e * e;
         }
+        // Compute the prediction errors with the updated parameters in a single pass.
+        container::transform(myTrainInput, myTrainInput + myTrainSetCount, myTrainOutput, 
+                             myPredErrors.begin(), [this](const double x, const double y)
+                             { return dabs(y - predict(x)); });
+
         // Save epochs used.
         myEpochsUsed++;
 
@@ -168,14 +174,10 @@ bool LinReg::trainWithNoEpoch(double learningRate) noexcept
 bool LinReg::isPredictDone() const noexcept
 {
     constexpr double tol = 1e-4;
-    for (size_t i{}; i < myTrainSetCount; ++i)
-    {
-        if (dabs(myPredVector[i] - myTrainOutput[i]) > tol)
-        {
-            return false;
-        }
-    }
-    return true;
+
+    // The predictions are done once the largest error is within the tolerance.
+    const auto errors{container::minMax(myPredErrors.begin(), myPredErrors.end())};
+    return (errors.second == myPredErrors.end()) || (*errors.second <= tol);
 }
 //--------------------------------------------------------------------------------//
 int LinReg::getEpochsUsed() const noexcept 
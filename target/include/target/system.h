@@ -3,6 +3,11 @@
  */
 #pragma once
 
+#include <stdint.h>
+
+#include "container/ring_buffer.h"
+#include "container/stat_window.h"
+
 namespace driver
 {
 /** ADC (A/D converter) interface. */
@@ -49,6 +54,9 @@ namespace target
  *            - A watchdog timer is used to restart the program if it gets stuck somewhere.
  *
  *            - The LED state is written to EEPROM upon every change. This value is evaluated upon startup.
+ *
+ *            - The last predicted temperatures are kept in a sliding window, which is used to print 
+ *              a smoothed temperature and to detect temperature drift.
  * 
  *        This class is non-copyable and non-movable.
  */
@@ -89,7 +97,7 @@ public:
     /**
      * @brief Button interrupt handler.
      * 
-     *        Toggle the timer whenever the button is pressed. 
+     *        Queue a button event whenever the button is pressed, the event is handled in run().
      * 
      *        Pin change interrupts are disabled for 300 ms after a press to mitigate the effects 
      *        of contact bounce.
@@ -104,14 +112,16 @@ public:
     void handleDebounceTimerInterrupt() noexcept;
 
     /**
-     * @brief Toggle timer interrupt handler.
+     * @brief Predict timer interrupt handler.
      * 
-     *        Toggle the LED every 100 ms when the associated timer is enabled.
+     *        Queue a prediction event whenever the timer elapses, the event is handled in run().
      */
     void handlepredictTimerInterrupt() noexcept;
 
     /**
-     * @brief Run the system as long as voltage is supplied.                                                               
+     * @brief Run the system as long as voltage is supplied.
+     * 
+     *        Events queued by the interrupt handlers are processed here, outside interrupt context.
      */
     void run() noexcept;
 
@@ -122,7 +132,16 @@ public:
     System& operator=(System&&)      = delete; // No move assignment.
 
 private:
+    /** Events queued by the interrupt handlers. */
+    enum class Event : uint8_t
+    {
+        ButtonPressed,      // The button was pressed.
+        PredictTimerElapsed // The predict timer elapsed.
+    };
+
+    void handleEvent(const Event event) noexcept;
     void handleButtonPressed() noexcept;
+    void predictTemperature() noexcept;
     void checkLedStateInEeprom() noexcept;
     void writeLedStateToEeprom() noexcept;
     bool readLedStateFromEeprom() const noexcept;
@@ -154,6 +173,13 @@ private:
     /** Linear regression model for temperature prediction. */
     ml::linreg::Interface& myLinReg;
 
+    /** Analog pin the temperature sensor is connected to. */
     const uint8_t mySensorPin;
+
+    /** Events queued by the interrupt handlers, processed in run(). */
+    container::RingBuffer<Event, 8U> myEvents;
+
+    /** The last predicted temperatures, used for smoothing and drift detection. */
+    container::StatWindow<double, 8U> myTemperatures;
 };
 } // namespace target
\ No newline at end of file
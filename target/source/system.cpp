@@ -24,6 +24,9 @@ constexpr int round(const double number)
     // Case 4: number = -4.2 => we cast -4.2 - 0.5 to int => -4.7 is converted to -4.
     return 0.0 <= number ? static_cast<int>(number + 0.5) : static_cast<int>(number - 0.5);
 }
+
+/** Temperature range within the window above which drift is reported. */
+constexpr double temperatureDriftLimit{5.0};
 } // namespace
 /**
  * @brief Structure of LED state parameters.
@@ -53,6 +56,8 @@ System::System(driver::GpioInterface& led, driver::GpioInterface& button,
     , myAdc{adc}
     , myLinReg{linReg}
     , mySensorPin{sensorPin}
+    , myEvents{}
+    , myTemperatures{}
 {
     myButton.enableInterrupt(true);
     mySerial.setEnabled(true);
@@ -82,7 +87,7 @@ void System::handleButtonInterrupt() noexcept
 {
     myButton.enableInterruptOnPort(false);
     myDebounceTimer.start();
-    if (myButton.read()) { handleButtonPressed(); }
+    if (myButton.read()) { myEvents.push(Event::ButtonPressed); }
 }
 
 // -----------------------------------------------------------------------------
@@ -95,8 +100,8 @@ void System::handleDebounceTimerInterrupt() noexcept
 // -----------------------------------------------------------------------------
 void System::handlepredictTimerInterrupt() noexcept 
 {
-    // Prediktera temperaturen och skriv ut här.
     // Timern startar om sig själv, så tänk inte på det. 
+    myEvents.push(Event::PredictTimerElapsed);
 }
 
 // -----------------------------------------------------------------------------
@@ -106,22 +111,54 @@ void System::run() noexcept
     
     while (1)
     {
+        // Handle the events queued by the interrupt handlers.
+        Event event{};
+        while (myEvents.pop(event)) { handleEvent(event); }
         myWatchdog.reset();
     }
 }
 
+// -----------------------------------------------------------------------------
+void System::handleEvent(const Event event) noexcept
+{
+    switch (event)
+    {
+        case Event::ButtonPressed:
+            handleButtonPressed();
+            break;
+        case Event::PredictTimerElapsed:
+            predictTemperature();
+            break;
+    }
+}
+
 // -----------------------------------------------------------------------------
 void System::handleButtonPressed() noexcept
 {
     mySerial.printf("Button pressed!\n");
 
-    // Läs av ADC, prediktera temperaturen och skriv ut den.
-    // Nollställ också 60-sekunderstimern.
+    // Prediktera temperaturen och nollställ också 60-sekunderstimern.
+    predictTemperature();
+    myPredictTimer.restart();
+}
 
+// -----------------------------------------------------------------------------
+void System::predictTemperature() noexcept
+{
+    // Läs av ADC, prediktera temperaturen och skriv ut den.
     const auto inputVoltage{myAdc.inputVoltage(mySensorPin)};
     const auto prediction{myLinReg.predict(inputVoltage)};
+    myTemperatures.push(prediction);
     
-    mySerial.printf("The temperature is: %d \n", round(prediction));
-    myPredictTimer.restart();
+    mySerial.printf("The temperature is: %d (average: %d)\n", 
+                    round(prediction), round(myTemperatures.mean()));
+
+    // Report drift when the temperature varies too much within the window.
+    const auto range{myTemperatures.max() - myTemperatures.min()};
+    if (range > temperatureDriftLimit)
+    {
+        mySerial.printf("Temperature drift: %d degrees over the last %d predictions!\n", 
+                        round(range), static_cast<int>(myTemperatures.size()));
+    }
 }
 } // namespace target
\ No newline at end of file
@@ -0,0 +1,93 @@
+/**
+ * @brief Host tests for the generic algorithms over container iterators (host build only).
+ */
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "container/algorithm.h"
+#include "container/vector.h"
+#include "test.h"
+
+namespace
+{
+/**
+ * @brief Create a random data set of given size.
+ *
+ *        Every third data set contains values in a narrow range to get many duplicates, and
+ *        every seventh data set is sorted in descending order.
+ */
+std::vector<int> randomData(const size_t size, const unsigned round)
+{
+    std::vector<int> data{};
+    const size_t range{round % 3U == 0U ? 5U : 1000U};
+    for (size_t i{}; i < size; ++i) { data.push_back(static_cast<int>(test::random(range))); }
+    if (round % 7U == 0U) { std::sort(data.begin(), data.end(), std::greater<int>()); }
+    return data;
+}
+
+/**
+ * @brief Copy given data into a new vector.
+ */
+container::Vector<int> toVector(const std::vector<int>& data)
+{
+    container::Vector<int> vector{};
+    for (const auto& value : data) { vector.pushBack(value); }
+    return vector;
+}
+
+// -----------------------------------------------------------------------------
+void testAlgorithms(const std::vector<int>& data, const std::vector<int>& sorted)
+{
+    auto vector{toVector(data)};
+    container::sort(vector.begin(), vector.end());
+    for (size_t i{}; i < sorted.size(); ++i) { CHECK(vector[i] == sorted[i]); }
+
+    if (!data.empty())
+    {
+        auto values{toVector(data)};
+        const auto k{test::random(data.size())};
+        auto nth{values.begin()};
+        nth += k;
+        container::nthElement(values.begin(), nth, values.end());
+        CHECK(values[k] == sorted[k]);
+        for (size_t i{}; i < k; ++i) { CHECK(values[i] <= values[k]); }
+        for (size_t i{k + 1U}; i < data.size(); ++i) { CHECK(values[i] >= values[k]); }
+
+        const auto minMax{container::minMax(vector.begin(), vector.end())};
+        CHECK(*minMax.first == sorted.front());
+        CHECK(*minMax.second == sorted.back());
+    }
+
+    auto values{toVector(data)};
+    auto isEven{[](const int value) { return value % 2 == 0; }};
+    const auto partitionPoint{container::partition(values.begin(), values.end(), isEven)};
+    const auto evenCount{static_cast<size_t>(std::count_if(data.begin(), data.end(), isEven))};
+    const auto evenEnd{static_cast<size_t>(container::distance(values.begin(), partitionPoint))};
+    CHECK(evenEnd == evenCount);
+    for (size_t i{}; i < data.size(); ++i) { CHECK((i < evenEnd) == isEven(values[i])); }
+
+    long sum{};
+    for (const auto& value : data) { sum += value; }
+    CHECK(container::accumulate(vector.begin(), vector.end(), 0L) == sum);
+}
+} // namespace
+
+/**
+ * @brief Run the algorithm tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    srand(1U);
+
+    for (unsigned round{}; round < 2000U; ++round)
+    {
+        const auto data{randomData(test::random(200U), round)};
+        auto sorted{data};
+        std::sort(sorted.begin(), sorted.end());
+        testAlgorithms(data, sorted);
+    }
+    return test::report();
+}
@@ -0,0 +1,65 @@
+/**
+ * @brief Host tests for container::Bitset (host build only).
+ */
+#include <algorithm>
+#include <vector>
+
+#include "container/bitset.h"
+#include "test.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+void testBitset()
+{
+    constexpr size_t bitCount{77U};
+
+    // Find the first index at or after given start holding given state in the reference.
+    auto find{[](const std::vector<bool>& bits, const size_t start, const bool state)
+    {
+        for (size_t i{start}; i < bits.size(); ++i) { if (bits[i] == state) { return i; } }
+        return bitCount;
+    }};
+
+    for (unsigned round{}; round < 300U; ++round)
+    {
+        container::Bitset<bitCount> bitset{};
+        std::vector<bool> reference(bitCount);
+
+        for (int op{}; op < 200; ++op)
+        {
+            const auto index{test::random(bitCount)};
+            switch (test::random(3U))
+            {
+                case 0U: bitset.set(index); reference[index] = true; break;
+                case 1U: bitset.reset(index); reference[index] = false; break;
+                default: bitset.flip(index); reference[index] = !reference[index]; break;
+            }
+            const auto count{static_cast<size_t>(std::count(reference.begin(), reference.end(), true))};
+            CHECK(bitset.count() == count);
+            CHECK(bitset.any() == (count > 0U));
+            CHECK(bitset.all() == (count == bitCount));
+            CHECK(bitset.findFirstSet() == find(reference, 0U, true));
+            CHECK(bitset.findFirstReset() == find(reference, 0U, false));
+            CHECK(bitset.findNextSet(index) == find(reference, index + 1U, true));
+        }
+        bitset.set();
+        CHECK(bitset.all() && (bitset.count() == bitCount));
+        CHECK(bitset.findFirstReset() == bitCount);
+        bitset.reset();
+        CHECK(!bitset.any());
+    }
+}
+} // namespace
+
+/**
+ * @brief Run the Bitset tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    srand(1U);
+    testBitset();
+    return test::report();
+}
@@ -0,0 +1,60 @@
+/**
+ * @brief Host tests for container::FlatMap (host build only).
+ */
+#include <map>
+
+#include "container/flat_map.h"
+#include "test.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+void testFlatMap()
+{
+    constexpr size_t capacity{13U};
+    constexpr unsigned keyCount{40U};
+
+    for (unsigned round{}; round < 500U; ++round)
+    {
+        container::FlatMap<unsigned, int, capacity> map{};
+        std::map<unsigned, int> reference{};
+
+        for (int op{}; op < 300; ++op)
+        {
+            const auto key{static_cast<unsigned>(test::random(keyCount))};
+            if (test::random(3U) < 2U)
+            {
+                const auto inserted{map.insert(key, op)};
+                const auto fits{(reference.count(key) != 0U) || (reference.size() < capacity)};
+                CHECK(inserted == fits);
+                if (fits) { reference[key] = op; }
+            }
+            else { CHECK(map.remove(key) == (reference.erase(key) == 1U)); }
+            CHECK(map.size() == reference.size());
+
+            for (unsigned k{}; k < keyCount; ++k)
+            {
+                const auto value{map.find(k)};
+                const auto expected{reference.find(k)};
+                CHECK((value != nullptr) == (expected != reference.end()));
+                if ((value != nullptr) && (expected != reference.end()))
+                {
+                    CHECK(*value == expected->second);
+                }
+            }
+        }
+    }
+}
+} // namespace
+
+/**
+ * @brief Run the FlatMap tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    srand(1U);
+    testFlatMap();
+    return test::report();
+}
@@ -0,0 +1,162 @@
+/**
+ * @brief Host tests for container::IntrusiveList (host build only).
+ */
+#include <vector>
+
+#include "container/intrusive_list.h"
+#include "test.h"
+
+namespace
+{
+/**
+ * @brief Element linkable into an intrusive list.
+ */
+struct Element : container::IntrusiveListHook
+{
+    explicit Element(const int value = 0) noexcept
+        : value{value} {}
+
+    int value;
+};
+
+/**
+ * @brief Check that the list holds the given values in order, walking both directions.
+ */
+void checkValues(const container::IntrusiveList<Element>& list, const std::vector<int>& reference)
+{
+    CHECK(list.size() == reference.size());
+    CHECK(list.empty() == reference.empty());
+
+    std::vector<int> forward{}, backward{};
+    for (const auto& element : list) { forward.push_back(element.value); }
+    for (auto it{list.rbegin()}; it != list.rend(); --it)
+    {
+        backward.insert(backward.begin(), (*it).value);
+    }
+    CHECK(forward == reference);
+    CHECK(backward == reference);
+
+    if (reference.empty()) { CHECK((nullptr == list.front()) && (nullptr == list.back())); }
+    else
+    {
+        CHECK((nullptr != list.front()) && (list.front()->value == reference.front()));
+        CHECK((nullptr != list.back()) && (list.back()->value == reference.back()));
+    }
+}
+
+// -----------------------------------------------------------------------------
+void testLinking()
+{
+    Element elements[6U]{Element{0}, Element{1}, Element{2}, Element{3}, Element{4}, Element{5}};
+    container::IntrusiveList<Element> list{};
+    checkValues(list, {});
+
+    CHECK(list.pushBack(elements[1U]));
+    CHECK(list.pushBack(elements[3U]));
+    CHECK(list.pushFront(elements[0U]));
+    checkValues(list, {0, 1, 3});
+
+    // Insert in the middle, at the beginning and at the end.
+    auto it{list.begin()};
+    ++it;
+    ++it;
+    CHECK(list.insert(it, elements[2U]));
+    CHECK(list.insert(list.end(), elements[5U]));
+    CHECK(list.insert(list.begin(), elements[4U]));
+    checkValues(list, {4, 0, 1, 2, 3, 5});
+    for (const auto& element : elements) { CHECK(element.isLinked()); }
+
+    // Linked elements are rejected.
+    CHECK(!list.pushBack(elements[2U]));
+    CHECK(!list.pushFront(elements[4U]));
+    CHECK(!list.insert(list.begin(), elements[5U]));
+    checkValues(list, {4, 0, 1, 2, 3, 5});
+
+    // Remove the first, a middle and the last element.
+    CHECK(list.remove(elements[4U]));
+    CHECK(list.remove(elements[2U]));
+    CHECK(list.remove(elements[5U]));
+    CHECK(!elements[4U].isLinked() && !elements[2U].isLinked() && !elements[5U].isLinked());
+    CHECK(!list.remove(elements[2U]));
+    checkValues(list, {0, 1, 3});
+
+    CHECK(list.popFront() == &elements[0U]);
+    CHECK(list.popBack() == &elements[3U]);
+    checkValues(list, {1});
+    CHECK(list.popBack() == &elements[1U]);
+    CHECK((nullptr == list.popFront()) && (nullptr == list.popBack()));
+    checkValues(list, {});
+}
+
+// -----------------------------------------------------------------------------
+void testClear()
+{
+    Element elements[4U]{Element{0}, Element{1}, Element{2}, Element{3}};
+    container::IntrusiveList<Element> list{}, other{};
+    for (auto& element : elements) { CHECK(list.pushBack(element)); }
+
+    list.clear();
+    checkValues(list, {});
+    for (const auto& element : elements) { CHECK(!element.isLinked()); }
+    CHECK(!list.remove(elements[0U]));
+
+    // Cleared elements can be linked again, into the same or another list.
+    CHECK(list.pushBack(elements[2U]));
+    CHECK(list.pushFront(elements[0U]));
+    CHECK(other.pushBack(elements[1U]));
+    CHECK(other.pushBack(elements[3U]));
+    checkValues(list, {0, 2});
+    checkValues(other, {1, 3});
+
+    // Deleting a list unlinks its elements.
+    {
+        container::IntrusiveList<Element> temporary{};
+        CHECK(list.remove(elements[2U]));
+        CHECK(temporary.pushBack(elements[2U]));
+    }
+    CHECK(!elements[2U].isLinked());
+    CHECK(list.pushBack(elements[2U]));
+    checkValues(list, {0, 2});
+}
+
+// -----------------------------------------------------------------------------
+void testForeignElements()
+{
+    Element elements[4U]{Element{0}, Element{1}, Element{2}, Element{3}};
+    container::IntrusiveList<Element> first{}, second{};
+    CHECK(first.pushBack(elements[0U]) && first.pushBack(elements[1U]));
+    CHECK(second.pushBack(elements[2U]) && second.pushBack(elements[3U]));
+
+    // Elements of another list are neither removed nor linked again.
+    CHECK(!first.remove(elements[2U]));
+    CHECK(!second.remove(elements[0U]));
+    CHECK(!first.pushBack(elements[3U]));
+    checkValues(first, {0, 1});
+    checkValues(second, {2, 3});
+
+    // Moving an element requires removing it from its list first.
+    CHECK(second.remove(elements[2U]));
+    CHECK(first.pushBack(elements[2U]));
+    CHECK(!second.remove(elements[2U]));
+    checkValues(first, {0, 1, 2});
+    checkValues(second, {3});
+
+    second.clear();
+    CHECK(!second.remove(elements[0U]));
+    CHECK(first.remove(elements[0U]));
+    checkValues(first, {1, 2});
+}
+} // namespace
+
+/**
+ * @brief Run the IntrusiveList tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    testLinking();
+    testClear();
+    testForeignElements();
+    return test::report();
+}
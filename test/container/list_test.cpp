@@ -0,0 +1,180 @@
+/**
+ * @brief Host tests for container::List (host build only).
+ */
+#include <algorithm>
+#include <vector>
+
+#include "container/list.h"
+#include "test.h"
+
+namespace
+{
+/**
+ * @brief Create a random data set of given size, with many duplicates for every third round.
+ */
+std::vector<int> randomData(const size_t size, const unsigned round)
+{
+    std::vector<int> data{};
+    const size_t range{round % 3U == 0U ? 5U : 1000U};
+    for (size_t i{}; i < size; ++i) { data.push_back(static_cast<int>(test::random(range))); }
+    return data;
+}
+
+/**
+ * @brief Get an iterator pointing at the node at given index of the list.
+ */
+container::List<int>::Iterator at(container::List<int>& list, const size_t index)
+{
+    auto it{list.begin()};
+    for (size_t i{}; i < index; ++i) { ++it; }
+    return it;
+}
+
+/**
+ * @brief Check that given list holds the reference values, traversed in both directions.
+ */
+void checkList(const container::List<int>& list, const std::vector<int>& reference)
+{
+    CHECK(list.size() == reference.size());
+    size_t i{};
+    for (const auto& value : list) { CHECK((i < reference.size()) && (value == reference[i])); ++i; }
+    CHECK(i == reference.size());
+
+    for (auto it{list.rbegin()}; it != list.rend(); --it)
+    {
+        CHECK((i > 0U) && (*it == reference[i - 1U]));
+        --i;
+    }
+    CHECK(i == 0U);
+}
+
+// -----------------------------------------------------------------------------
+void testSortAndMerge(const std::vector<int>& data)
+{
+    auto sorted{data};
+    std::sort(sorted.begin(), sorted.end());
+
+    container::List<int> list{};
+    for (const auto& value : data) { list.pushBack(value); }
+    list.sort(utils::Less<int>{});
+    checkList(list, sorted);
+
+    container::List<int> other{};
+    std::vector<int> merged{sorted};
+    const auto otherSize{test::random(50U)};
+    for (size_t i{}; i < otherSize; ++i)
+    {
+        const auto value{static_cast<int>(test::random(1000U))};
+        other.pushBack(value);
+        merged.push_back(value);
+    }
+    std::sort(merged.begin(), merged.end());
+    other.sort(utils::Less<int>{});
+    list.merge(other, utils::Less<int>{});
+    checkList(list, merged);
+    CHECK(other.empty());
+}
+
+// -----------------------------------------------------------------------------
+void testInsertAndRemove(const std::vector<int>& data)
+{
+    container::List<int> list{};
+    std::vector<int> reference{};
+
+    // Insert in front of random nodes, including the first and the last node.
+    for (const auto& value : data)
+    {
+        if (reference.empty())
+        {
+            CHECK(list.pushBack(value));
+            reference.push_back(value);
+            continue;
+        }
+        const auto index{test::random(reference.size())};
+        auto it{at(list, index)};
+        CHECK(list.insert(it, value));
+        reference.insert(reference.begin() + static_cast<long>(index), value);
+    }
+    checkList(list, reference);
+
+    // Remove random nodes, including the first and the last node, until the list is empty.
+    while (!reference.empty())
+    {
+        const auto index{test::random(reference.size())};
+        auto it{at(list, index)};
+        CHECK(list.remove(it));
+        reference.erase(reference.begin() + static_cast<long>(index));
+        checkList(list, reference);
+    }
+    auto end{list.end()};
+    CHECK(!list.remove(end));
+    CHECK(!list.insert(end, 0));
+}
+
+// -----------------------------------------------------------------------------
+void testSplice(const std::vector<int>& data)
+{
+    container::List<int> list{}, other{};
+    std::vector<int> reference{}, otherReference{};
+    for (size_t i{}; i < data.size(); ++i)
+    {
+        if (i % 2U == 0U) { list.pushBack(data[i]); reference.push_back(data[i]); }
+        else { other.pushBack(data[i]); otherReference.push_back(data[i]); }
+    }
+
+    // Move single nodes from the other list to random positions, including the back.
+    while (!otherReference.empty())
+    {
+        const auto source{test::random(otherReference.size())};
+        const auto position{test::random(reference.size() + 1U)};
+        CHECK(list.splice(at(list, position), other, at(other, source)));
+        reference.insert(reference.begin() + static_cast<long>(position),
+                         otherReference[source]);
+        otherReference.erase(otherReference.begin() + static_cast<long>(source));
+        checkList(list, reference);
+        checkList(other, otherReference);
+    }
+
+    // Move single nodes within the list.
+    for (size_t i{}; (i < 10U) && !reference.empty(); ++i)
+    {
+        const auto source{test::random(reference.size())};
+        const auto position{test::random(reference.size() + 1U)};
+        CHECK(list.splice(at(list, position), list, at(list, source)));
+        const auto value{reference[source]};
+        reference.insert(reference.begin() + static_cast<long>(position), value);
+        reference.erase(reference.begin() + static_cast<long>(position <= source ? source + 1U : source));
+        checkList(list, reference);
+    }
+
+    // Move a whole list in front of a random position.
+    container::List<int> chain{};
+    std::vector<int> chainReference{};
+    for (int i{}; i < 5; ++i) { chain.pushBack(-i); chainReference.push_back(-i); }
+    const auto position{test::random(reference.size() + 1U)};
+    list.splice(at(list, position), chain);
+    reference.insert(reference.begin() + static_cast<long>(position), chainReference.begin(),
+                     chainReference.end());
+    checkList(list, reference);
+    CHECK(chain.empty());
+}
+} // namespace
+
+/**
+ * @brief Run the List tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    srand(1U);
+
+    for (unsigned round{}; round < 1000U; ++round)
+    {
+        const auto data{randomData(test::random(100U), round)};
+        testSortAndMerge(data);
+        testInsertAndRemove(data);
+        testSplice(data);
+    }
+    return test::report();
+}
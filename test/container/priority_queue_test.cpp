@@ -0,0 +1,128 @@
+/**
+ * @brief Host tests for container::PriorityQueue (host build only).
+ */
+#include <set>
+#include <utility>
+
+#include "container/priority_queue.h"
+#include "container/static_vector.h"
+#include "test.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+void testHeapOrder()
+{
+    // The default queue is a max-heap, i.e. values are popped in descending order.
+    for (unsigned round{}; round < 100U; ++round)
+    {
+        container::PriorityQueue<int> queue{};
+        std::multiset<int> reference{};
+        const auto count{test::random(100U)};
+        for (size_t i{}; i < count; ++i)
+        {
+            const auto value{static_cast<int>(test::random(50U))};
+            CHECK(queue.push(value));
+            reference.insert(value);
+        }
+        CHECK(queue.size() == reference.size());
+
+        int value{};
+        while (queue.pop(value))
+        {
+            CHECK(!reference.empty() && (value == *reference.rbegin()));
+            if (!reference.empty()) { reference.erase(--reference.end()); }
+        }
+        CHECK(reference.empty() && queue.empty());
+    }
+}
+
+// -----------------------------------------------------------------------------
+void testPriorityQueue()
+{
+    constexpr size_t taskCount{64U};
+
+    struct Task
+    {
+        size_t id;
+        int key;
+    };
+
+    // Order by key, then by id, to make the order of equal keys deterministic.
+    struct Compare
+    {
+        bool operator()(const Task& x, const Task& y) const noexcept
+        {
+            return (x.key > y.key) || ((x.key == y.key) && (x.id > y.id));
+        }
+    };
+
+    size_t position[taskCount]{};
+    bool queued[taskCount]{};
+    int key[taskCount]{};
+    auto tracker{[&position](const Task& task, const size_t index) { position[task.id] = index; }};
+
+    using Queue = container::PriorityQueue<Task, Compare, container::StaticVector<Task, taskCount>,
+                                           decltype(tracker)>;
+    Queue queue{Compare{}, tracker};
+    std::set<std::pair<int, size_t>> reference{};
+
+    for (unsigned op{}; op < 200000U; ++op)
+    {
+        const auto id{test::random(taskCount)};
+        switch (test::random(4U))
+        {
+            case 0U:
+                if (queued[id]) { break; }
+                key[id] = static_cast<int>(test::random(1000U));
+                CHECK(queue.push(Task{id, key[id]}));
+                reference.insert({key[id], id});
+                queued[id] = true;
+                break;
+            case 1U:
+                if (!queued[id]) { break; }
+                reference.erase({key[id], id});
+                key[id] = static_cast<int>(test::random(1000U));
+                reference.insert({key[id], id});
+                CHECK(queue.update(position[id], Task{id, key[id]}));
+                break;
+            case 2U:
+                if (!queued[id]) { break; }
+                reference.erase({key[id], id});
+                CHECK(queue.remove(position[id]));
+                CHECK(position[id] == Queue::Removed);
+                queued[id] = false;
+                break;
+            default:
+            {
+                if (reference.empty()) { break; }
+                Task task{};
+                CHECK(queue.pop(task));
+                const auto expected{*reference.begin()};
+                reference.erase(reference.begin());
+                CHECK((task.key == expected.first) && (task.id == expected.second));
+                queued[task.id] = false;
+                break;
+            }
+        }
+        CHECK(queue.size() == reference.size());
+        for (size_t i{}; i < taskCount; ++i)
+        {
+            if (queued[i]) { CHECK((position[i] < queue.size()) && (queue[position[i]].id == i)); }
+        }
+    }
+}
+} // namespace
+
+/**
+ * @brief Run the PriorityQueue tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    srand(1U);
+    testHeapOrder();
+    testPriorityQueue();
+    return test::report();
+}
@@ -0,0 +1,162 @@
+/**
+ * @brief Host tests for container::ProgmemArray (host build only).
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "container/progmem_array.h"
+#include "test.h"
+
+namespace
+{
+/**
+ * @brief Element of three bytes with byte alignment, read via a block copy.
+ */
+struct Rgb
+{
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+};
+
+/** The size of the test arrays. */
+constexpr size_t arraySize{7U};
+
+constexpr container::ProgmemArray<uint8_t, arraySize> bytes PROGMEM{
+    {0U, 1U, 0x7FU, 0x80U, 0xFEU, 0xFFU, 42U}};
+constexpr container::ProgmemArray<int16_t, arraySize> words PROGMEM{
+    {0, -1, 1, INT16_MIN, INT16_MAX, 0x1234, -0x1234}};
+constexpr container::ProgmemArray<uint32_t, arraySize> dwords PROGMEM{
+    {0U, 1U, 0xFFFFFFFFU, 0x80000000U, 0x12345678U, 0xDEADBEEFU, 7U}};
+constexpr container::ProgmemArray<float, arraySize> floats PROGMEM{
+    {0.0F, -1.5F, 3.25F, 1e-30F, -1e30F, 0.1F, 12345.678F}};
+constexpr container::ProgmemArray<double, arraySize> doubles PROGMEM{
+    {0.0, -1.5, 3.25, 1e-300, -1e300, 0.1, 12345.678}};
+constexpr container::ProgmemArray<int64_t, arraySize> quadwords PROGMEM{
+    {0, -1, INT64_MIN, INT64_MAX, 0x123456789ABCDEF0, -2, 3}};
+constexpr container::ProgmemArray<Rgb, arraySize> colors PROGMEM{
+    {{0U, 1U, 2U}, {3U, 4U, 5U}, {6U, 7U, 8U}, {9U, 10U, 11U}, {12U, 13U, 14U}, {15U, 16U, 17U},
+     {255U, 254U, 253U}}};
+
+/**
+ * @brief Check whether two values hold the same bytes.
+ */
+template <typename T>
+bool isEqual(const T& x, const T& y) noexcept { return 0 == memcmp(&x, &y, sizeof(T)); }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void testRead(const container::ProgmemArray<T, arraySize>& array)
+{
+    static_assert(arraySize == container::ProgmemArray<T, arraySize>::size(), "Wrong array size!");
+    const auto data{array.data()};
+
+    // Subscript operator and static read.
+    for (size_t i{}; i < arraySize; ++i)
+    {
+        CHECK(isEqual(array[i], data[i]));
+        CHECK(isEqual(container::ProgmemArray<T, arraySize>::read(data + i), data[i]));
+    }
+
+    // Iteration in both directions.
+    size_t index{};
+    for (const auto value : array) { CHECK(isEqual(value, data[index++])); }
+    CHECK(arraySize == index);
+    CHECK(static_cast<ptrdiff_t>(arraySize) == array.end() - array.begin());
+
+    auto it{array.end()};
+    while (it != array.begin())
+    {
+        --it;
+        CHECK(isEqual(*it, data[--index]));
+    }
+    CHECK(0U == index);
+
+    it = array.begin();
+    it += 3U;
+    CHECK(isEqual(*it, data[3U]));
+    it -= 2U;
+    CHECK(isEqual(*it, data[1U]));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void testCopy(const container::ProgmemArray<T, arraySize>& array)
+{
+    const auto data{array.data()};
+    constexpr size_t guardCount{arraySize + 2U};
+    T destination[guardCount];
+    T guard;
+    memset(&guard, 0xA5, sizeof(T));
+
+    // Copy given range, check that the values past the copied ones are left untouched.
+    auto check{[&](const size_t offset, const size_t count, const size_t expected)
+    {
+        for (auto& value : destination) { value = guard; }
+        CHECK(expected == array.copy(destination, offset, count));
+        for (size_t i{}; i < guardCount; ++i)
+        {
+            CHECK(i < expected ? isEqual(destination[i], data[offset + i])
+                               : isEqual(destination[i], guard));
+        }
+    }};
+
+    check(0U, arraySize, arraySize);
+    check(0U, 3U, 3U);
+    check(2U, 3U, 3U);
+    check(0U, 0U, 0U);
+
+    // The count is truncated at the end of the array.
+    check(4U, 10U, arraySize - 4U);
+    check(arraySize - 1U, SIZE_MAX, 1U);
+
+    // Offsets at or past the end copy nothing.
+    check(arraySize, 1U, 0U);
+    check(arraySize + 1U, 1U, 0U);
+    check(SIZE_MAX, SIZE_MAX, 0U);
+
+    // The default arguments copy the whole array.
+    for (auto& value : destination) { value = guard; }
+    CHECK(arraySize == array.copy(destination));
+    CHECK(0 == memcmp(destination, data, sizeof(T) * arraySize));
+    CHECK(isEqual(destination[arraySize], guard));
+    CHECK(arraySize - 5U == array.copy(destination, 5U));
+}
+
+/**
+ * @brief Run the tests for given array.
+ */
+template <typename T>
+void testArray(const container::ProgmemArray<T, arraySize>& array)
+{
+    testRead(array);
+    testCopy(array);
+}
+} // namespace
+
+/**
+ * @brief Run the ProgmemArray tests.
+ *
+ *        The element types cover each branch of ProgmemArray::read(), i.e. byte, word and
+ *        double word loads as well as block copies.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    testArray(bytes);
+    testArray(words);
+    testArray(dwords);
+    testArray(floats);
+    testArray(doubles);
+    testArray(quadwords);
+    testArray(colors);
+
+    CHECK((255U == bytes[5U]) && (42U == bytes[6U]));
+    CHECK((INT16_MIN == words[3U]) && (-0x1234 == words[6U]));
+    CHECK(0xDEADBEEFU == dwords[5U]);
+    CHECK((3.25F == floats[2U]) && (-1e300 == doubles[4U]));
+    CHECK(INT64_MIN == quadwords[2U]);
+    CHECK((255U == colors[6U].red) && (253U == colors[6U].blue));
+    return test::report();
+}
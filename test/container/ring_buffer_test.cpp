@@ -0,0 +1,144 @@
+/**
+ * @brief Host tests for container::RingBuffer (host build only).
+ */
+#include <deque>
+
+#include "container/ring_buffer.h"
+#include "test.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+void testBulkTransfer()
+{
+    container::RingBuffer<int, 8U> buffer{};
+    CHECK(buffer.empty() && !buffer.full() && (0U == buffer.size()));
+    CHECK(8U == buffer.capacity());
+
+    // A bulk push is truncated at the capacity.
+    const int values[]{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    CHECK(5U == buffer.push(values, 5U));
+    CHECK(3U == buffer.push(values + 5U, 7U));
+    CHECK(buffer.full() && !buffer.empty() && (8U == buffer.size()));
+    CHECK(!buffer.push(values[8U]));
+    CHECK(0U == buffer.push(values, 1U));
+
+    // A partial bulk pop leaves the remaining values in order.
+    int output[12U]{};
+    CHECK(3U == buffer.pop(output, 3U));
+    CHECK((0 == output[0U]) && (1 == output[1U]) && (2 == output[2U]));
+    CHECK(!buffer.full() && (5U == buffer.size()));
+
+    // Fill up again across the end of the storage, then pop more than is stored.
+    CHECK(3U == buffer.push(values + 8U, 4U));
+    CHECK(buffer.full());
+    CHECK(8U == buffer.pop(output, 12U));
+    for (int i{}; i < 8; ++i) { CHECK(output[i] == i + 3); }
+    CHECK(buffer.empty() && (0U == buffer.size()));
+
+    // Popping from an empty buffer leaves the output untouched.
+    int value{-1};
+    CHECK(!buffer.pop(value) && (-1 == value));
+    CHECK(0U == buffer.pop(output, 4U));
+}
+
+// -----------------------------------------------------------------------------
+void testWrapAround()
+{
+    // With capacity 128 the 8-bit indices wrap around at 256, i.e. every other lap.
+    container::RingBuffer<unsigned, 128U> buffer{};
+    std::deque<unsigned> reference{};
+    unsigned next{}, expected{};
+
+    for (int op{}; op < 5000; ++op)
+    {
+        unsigned values[200U]{};
+        const auto count{test::random(200U)};
+        if (0U == test::random(2U))
+        {
+            for (size_t i{}; i < count; ++i) { values[i] = next + i; }
+            const auto pushed{buffer.push(values, count)};
+            const auto free{128U - reference.size()};
+            CHECK(pushed == (count < free ? count : free));
+            for (size_t i{}; i < pushed; ++i) { reference.push_back(next++); }
+        }
+        else
+        {
+            const auto popped{buffer.pop(values, count)};
+            CHECK(popped == (count < reference.size() ? count : reference.size()));
+            for (size_t i{}; i < popped; ++i)
+            {
+                CHECK(values[i] == reference.front());
+                CHECK(values[i] == expected++);
+                reference.pop_front();
+            }
+        }
+        CHECK(buffer.size() == reference.size());
+        CHECK(buffer.empty() == reference.empty());
+        CHECK(buffer.full() == (128U == reference.size()));
+    }
+    CHECK(next > 10U * 256U);
+
+    // Full and empty are told apart when the indices differ by exactly the capacity.
+    buffer.clear();
+    for (unsigned lap{}; lap < 5U; ++lap)
+    {
+        for (unsigned i{}; i < 128U; ++i) { CHECK(buffer.push(lap * 128U + i)); }
+        CHECK(buffer.full() && (128U == buffer.size()));
+        CHECK(!buffer.push(0U));
+        for (unsigned i{}; i < 128U; ++i)
+        {
+            unsigned value{};
+            CHECK(buffer.pop(value) && (value == lap * 128U + i));
+        }
+        CHECK(buffer.empty() && (0U == buffer.size()));
+    }
+}
+
+// -----------------------------------------------------------------------------
+void testClear()
+{
+    container::RingBuffer<int, 4U> buffer{};
+    buffer.clear();
+    CHECK(buffer.empty());
+
+    const int values[]{1, 2, 3, 4};
+    CHECK(4U == buffer.push(values, 4U));
+    buffer.clear();
+    CHECK(buffer.empty() && !buffer.full() && (0U == buffer.size()));
+    int value{};
+    CHECK(!buffer.pop(value));
+
+    // The full capacity is available after clearing, old values don't reappear.
+    CHECK(2U == buffer.push(values + 2U, 2U));
+    buffer.clear();
+    CHECK(buffer.push(7) && buffer.push(8));
+    CHECK(buffer.pop(value) && (7 == value));
+    CHECK(3U == buffer.push(values, 4U));
+    CHECK(buffer.full());
+    int output[4U]{};
+    CHECK(4U == buffer.pop(output, 4U));
+    CHECK((8 == output[0U]) && (1 == output[1U]) && (2 == output[2U]) && (3 == output[3U]));
+
+    // A single-slot buffer is full after one push.
+    container::RingBuffer<int, 1U> single{};
+    CHECK(single.push(5) && single.full() && !single.push(6));
+    single.clear();
+    CHECK(single.empty() && single.push(6));
+    CHECK(single.pop(value) && (6 == value) && single.empty());
+}
+} // namespace
+
+/**
+ * @brief Run the RingBuffer tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    srand(1U);
+    testBulkTransfer();
+    testWrapAround();
+    testClear();
+    return test::report();
+}
@@ -0,0 +1,278 @@
+/**
+ * @brief Host tests for container::SmallVector (host build only).
+ */
+#include <vector>
+
+#include "container/small_vector.h"
+#include "test.h"
+
+namespace
+{
+/**
+ * @brief Element counting its live instances, to verify construction and destruction.
+ */
+class Counted
+{
+public:
+    /** The number of live instances. */
+    static inline int liveCount{0};
+
+    /** The number of instances moved from. */
+    static inline int moveCount{0};
+
+    Counted(const int value = 0) noexcept
+        : myValue{value} { ++liveCount; }
+
+    Counted(const Counted& other) noexcept
+        : myValue{other.myValue} { ++liveCount; }
+
+    Counted(Counted&& other) noexcept
+        : myValue{other.myValue}
+    {
+        other.myValue = -1;
+        ++liveCount;
+        ++moveCount;
+    }
+
+    ~Counted() noexcept { --liveCount; }
+
+    Counted& operator=(const Counted& other) noexcept
+    {
+        myValue = other.myValue;
+        return *this;
+    }
+
+    Counted& operator=(Counted&& other) noexcept
+    {
+        myValue       = other.myValue;
+        other.myValue = -1;
+        return *this;
+    }
+
+    int value() const noexcept { return myValue; }
+
+private:
+    /** The stored value, -1 when moved from. */
+    int myValue;
+};
+
+/**
+ * @brief Check that given vector holds the reference values.
+ */
+template <typename T, size_t N>
+void checkValues(const container::SmallVector<T, N>& vector, const std::vector<int>& reference)
+{
+    CHECK(vector.size() == reference.size());
+    CHECK(vector.capacity() >= vector.size());
+    for (size_t i{}; (i < vector.size()) && (i < reference.size()); ++i)
+    {
+        CHECK(static_cast<int>(vector[i]) == reference[i]);
+    }
+}
+
+/**
+ * @brief Check that given vector holds the reference values, element type Counted.
+ */
+template <size_t N>
+void checkValues(const container::SmallVector<Counted, N>& vector,
+                 const std::vector<int>& reference)
+{
+    CHECK(vector.size() == reference.size());
+    for (size_t i{}; (i < vector.size()) && (i < reference.size()); ++i)
+    {
+        CHECK(vector[i].value() == reference[i]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void testSpillOverAndShrink()
+{
+    constexpr size_t inlineCapacity{4U};
+    container::SmallVector<T, inlineCapacity> vector{};
+    std::vector<int> reference{};
+    CHECK(vector.isInline() && vector.empty());
+    CHECK(vector.capacity() == inlineCapacity);
+
+    // The inline storage is used until it's full.
+    for (int i{}; i < static_cast<int>(inlineCapacity); ++i)
+    {
+        CHECK(vector.pushBack(T{i}));
+        reference.push_back(i);
+        CHECK(vector.isInline());
+    }
+    checkValues(vector, reference);
+
+    // Growing past the inline capacity moves the elements to the heap.
+    CHECK(vector.pushBack(T{100}));
+    reference.push_back(100);
+    CHECK(!vector.isInline());
+    CHECK(vector.capacity() > inlineCapacity);
+    checkValues(vector, reference);
+
+    for (int i{}; i < 20; ++i)
+    {
+        CHECK(vector.emplaceBack(i * 2));
+        reference.push_back(i * 2);
+    }
+    checkValues(vector, reference);
+
+    // Shrinking while the elements don't fit inline keeps them on the heap.
+    CHECK(vector.shrinkToFit());
+    CHECK(!vector.isInline() && (vector.capacity() == vector.size()));
+    checkValues(vector, reference);
+
+    // Shrinking when the elements fit inline moves them back to the inline storage.
+    while (vector.size() > inlineCapacity - 1U)
+    {
+        CHECK(vector.popBack());
+        reference.pop_back();
+    }
+    CHECK(!vector.isInline());
+    CHECK(vector.shrinkToFit());
+    CHECK(vector.isInline() && (vector.capacity() == inlineCapacity));
+    checkValues(vector, reference);
+
+    // Growing via resize and shrinking via clear.
+    CHECK(vector.resize(10U));
+    reference.resize(10U);
+    CHECK(!vector.isInline());
+    checkValues(vector, reference);
+    vector.clear();
+    CHECK(vector.isInline() && vector.empty() && (vector.capacity() == inlineCapacity));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void testMove()
+{
+    constexpr size_t inlineCapacity{4U};
+
+    // Moving from an inline source moves the elements one by one.
+    container::SmallVector<T, inlineCapacity> inlineSource{};
+    for (int i{}; i < 3; ++i) { inlineSource.pushBack(T{i}); }
+    container::SmallVector<T, inlineCapacity> fromInline{utils::move(inlineSource)};
+    CHECK(fromInline.isInline());
+    checkValues(fromInline, {0, 1, 2});
+    CHECK(inlineSource.empty() && inlineSource.isInline());
+
+    // Moving from a heap source takes over the memory without touching the elements.
+    container::SmallVector<T, inlineCapacity> heapSource{};
+    for (int i{}; i < 10; ++i) { heapSource.pushBack(T{i}); }
+    const auto heapData{heapSource.data()};
+    container::SmallVector<T, inlineCapacity> fromHeap{utils::move(heapSource)};
+    CHECK(!fromHeap.isInline() && (fromHeap.data() == heapData));
+    checkValues(fromHeap, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    CHECK(heapSource.empty() && heapSource.isInline());
+    CHECK(heapSource.capacity() == inlineCapacity);
+
+    // Move assignment releases the previous elements of the target.
+    fromHeap = utils::move(fromInline);
+    CHECK(fromHeap.isInline());
+    checkValues(fromHeap, {0, 1, 2});
+    CHECK(fromInline.empty());
+
+    // The moved-from vectors are still usable.
+    CHECK(heapSource.pushBack(T{7}));
+    checkValues(heapSource, {7});
+
+    // Copies are independent of the source.
+    container::SmallVector<T, inlineCapacity> copy{fromHeap};
+    copy[0U] = T{42};
+    checkValues(copy, {42, 1, 2});
+    checkValues(fromHeap, {0, 1, 2});
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void testAliasing()
+{
+    constexpr size_t inlineCapacity{4U};
+
+    // Append the vector to itself while spilling over from the inline storage.
+    container::SmallVector<T, inlineCapacity> vector{};
+    for (int i{}; i < 3; ++i) { vector.pushBack(T{i}); }
+    vector += vector;
+    CHECK(!vector.isInline());
+    checkValues(vector, {0, 1, 2, 0, 1, 2});
+
+    // Append the vector to itself while reallocating the heap memory.
+    CHECK(vector.shrinkToFit());
+    vector += vector;
+    checkValues(vector, {0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2});
+
+    // Push an element of the vector itself while spilling over, the reference is invalidated
+    // by the reallocation.
+    container::SmallVector<T, inlineCapacity> full{};
+    for (int i{}; i < static_cast<int>(inlineCapacity); ++i) { full.pushBack(T{i + 10}); }
+    CHECK(full.pushBack(full[1U]));
+    CHECK(!full.isInline());
+    checkValues(full, {10, 11, 12, 13, 11});
+
+    CHECK(full.shrinkToFit());
+    CHECK(full.emplaceBack(full[0U]));
+    checkValues(full, {10, 11, 12, 13, 11, 10});
+}
+
+// -----------------------------------------------------------------------------
+void testLifetimes()
+{
+    Counted::liveCount = 0;
+    Counted::moveCount = 0;
+    {
+        container::SmallVector<Counted, 2U> vector{};
+        for (int i{}; i < 2; ++i) { vector.emplaceBack(i); }
+        CHECK(Counted::liveCount == 2);
+
+        // Spilling over moves the elements to the heap and destroys the inline ones.
+        vector.emplaceBack(2);
+        CHECK(Counted::liveCount == 3);
+        CHECK(Counted::moveCount >= 2);
+
+        for (int i{3}; i < 9; ++i) { vector.emplaceBack(i); }
+        CHECK(Counted::liveCount == 9);
+        vector.resize(5U);
+        CHECK(Counted::liveCount == 5);
+        vector.resize(7U);
+        CHECK(Counted::liveCount == 7);
+        checkValues(vector, {0, 1, 2, 3, 4, 0, 0});
+
+        vector.popBack();
+        CHECK(Counted::liveCount == 6);
+        vector.resize(2U);
+        vector.shrinkToFit();
+        CHECK(vector.isInline());
+        CHECK(Counted::liveCount == 2);
+
+        container::SmallVector<Counted, 2U> copy{vector};
+        CHECK(Counted::liveCount == 4);
+        copy = vector;
+        CHECK(Counted::liveCount == 4);
+        container::SmallVector<Counted, 2U> moved{utils::move(copy)};
+        CHECK(Counted::liveCount == 4);
+        vector.clear();
+        CHECK(Counted::liveCount == 2);
+    }
+    CHECK(Counted::liveCount == 0);
+}
+} // namespace
+
+/**
+ * @brief Run the SmallVector tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    // Trivially copyable elements take the memcpy and realloc paths.
+    testSpillOverAndShrink<int>();
+    testMove<int>();
+    testAliasing<int>();
+
+    testSpillOverAndShrink<Counted>();
+    testMove<Counted>();
+    testAliasing<Counted>();
+    testLifetimes();
+    CHECK(Counted::liveCount == 0);
+    return test::report();
+}
@@ -0,0 +1,51 @@
+/**
+ * @brief Host tests for container::SortedMap (host build only).
+ */
+#include <map>
+
+#include "container/sorted_map.h"
+#include "test.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+void testSortedMap()
+{
+    for (unsigned round{}; round < 300U; ++round)
+    {
+        container::SortedMap<int, int> map{};
+        std::map<int, int> reference{};
+
+        for (int op{}; op < 200; ++op)
+        {
+            const auto key{static_cast<int>(test::random(60U))};
+            if (test::random(3U) != 0U)
+            {
+                CHECK(map.insert(key, op));
+                reference[key] = op;
+            }
+            else { CHECK(map.remove(key) == (reference.erase(key) == 1U)); }
+            CHECK(map.size() == reference.size());
+
+            size_t i{};
+            for (const auto& entry : reference)
+            {
+                CHECK((map[i].first == entry.first) && (map[i].second == entry.second));
+                ++i;
+            }
+        }
+    }
+}
+} // namespace
+
+/**
+ * @brief Run the SortedMap tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    srand(1U);
+    testSortedMap();
+    return test::report();
+}
@@ -0,0 +1,200 @@
+/**
+ * @brief Host tests for container::Span (host build only).
+ */
+#include "container/array.h"
+#include "container/small_vector.h"
+#include "container/span.h"
+#include "container/static_vector.h"
+#include "container/vector.h"
+#include "test.h"
+
+namespace
+{
+/**
+ * @brief Check that given span views given data.
+ */
+template <typename T, typename U>
+bool views(const container::Span<T>& span, U* data, const size_t size) noexcept
+{
+    return (span.data() == data) && (span.size() == size) && (span.empty() == (0U == size)) &&
+           (span.begin() == data) && (span.end() == data + size);
+}
+
+/**
+ * @brief Sum the elements of given read-only span, used to check the implicit conversions.
+ */
+int sum(const container::Span<const int> span) noexcept
+{
+    int result{};
+    for (const auto value : span) { result += value; }
+    return result;
+}
+
+/**
+ * @brief Increment the elements of given span, used to check the implicit conversions.
+ */
+void increment(const container::Span<int> span) noexcept
+{
+    for (auto& value : span) { ++value; }
+}
+
+// -----------------------------------------------------------------------------
+void testConstruction()
+{
+    const container::Span<int> empty{};
+    CHECK(views(empty, static_cast<int*>(nullptr), 0U));
+
+    int values[]{1, 2, 3, 4};
+    const container::Span<int> pointer{values + 1U, 2U};
+    CHECK(views(pointer, values + 1U, 2U));
+
+    // C arrays.
+    const container::Span<int> cArray{values};
+    CHECK(views(cArray, values, 4U));
+    const int constValues[]{5, 6};
+    const container::Span<const int> constCArray{constValues};
+    CHECK(views(constCArray, constValues, 2U));
+
+    // Arrays.
+    container::Array<int, 3U> array{1, 2, 3};
+    const auto& constArray{array};
+    const container::Span<int> arraySpan{array};
+    const container::Span<const int> constArraySpan{constArray};
+    CHECK(views(arraySpan, array.data(), 3U));
+    CHECK(views(constArraySpan, constArray.data(), 3U));
+
+    // Vectors.
+    container::Vector<int> vector{};
+    for (int i{}; i < 5; ++i) { CHECK(vector.pushBack(i)); }
+    const auto& constVector{vector};
+    const container::Span<int> vectorSpan{vector};
+    const container::Span<const int> constVectorSpan{constVector};
+    CHECK(views(vectorSpan, vector.data(), 5U));
+    CHECK(views(constVectorSpan, constVector.data(), 5U));
+
+    // Static vectors.
+    container::StaticVector<int, 8U> staticVector{};
+    for (int i{}; i < 6; ++i) { CHECK(staticVector.pushBack(i)); }
+    const auto& constStaticVector{staticVector};
+    const container::Span<int> staticSpan{staticVector};
+    const container::Span<const int> constStaticSpan{constStaticVector};
+    CHECK(views(staticSpan, staticVector.data(), 6U));
+    CHECK(views(constStaticSpan, constStaticVector.data(), 6U));
+
+    // Small vectors, stored inline and spilled to the heap.
+    container::SmallVector<int, 4U> smallVector{};
+    for (int i{}; i < 3; ++i) { CHECK(smallVector.pushBack(i)); }
+    const auto& constSmallVector{smallVector};
+    CHECK(views(container::Span<int>{smallVector}, smallVector.data(), 3U));
+    CHECK(views(container::Span<const int>{constSmallVector}, constSmallVector.data(), 3U));
+    for (int i{}; i < 7; ++i) { CHECK(smallVector.pushBack(i)); }
+    CHECK(views(container::Span<int>{smallVector}, smallVector.data(), 10U));
+    CHECK(views(container::Span<const int>{constSmallVector}, constSmallVector.data(), 10U));
+
+    // Read-only views of mutable spans, and copies.
+    const container::Span<const int> readOnly{cArray};
+    CHECK(views(readOnly, values, 4U));
+    const auto copy{cArray};
+    CHECK(views(copy, values, 4U));
+
+    // Mutable spans write through to the viewed data.
+    cArray[2U] = 30;
+    CHECK(30 == values[2U]);
+    CHECK(30 == readOnly[2U]);
+}
+
+// -----------------------------------------------------------------------------
+void testConversions()
+{
+    int values[]{1, 2, 3};
+    container::Array<int, 2U> array{10, 20};
+    container::Vector<int> vector{};
+    container::StaticVector<int, 4U> staticVector{};
+    container::SmallVector<int, 2U> smallVector{};
+    for (int i{1}; i <= 3; ++i)
+    {
+        CHECK(vector.pushBack(i * 100));
+        CHECK(staticVector.pushBack(i * 1000));
+        CHECK(smallVector.pushBack(i * 10000));
+    }
+
+    // Implicit conversions to mutable spans.
+    increment(values);
+    increment(array);
+    increment(vector);
+    increment(staticVector);
+    increment(smallVector);
+
+    // Implicit conversions to read-only spans, from mutable and const containers.
+    const auto& constVector{vector};
+    const auto& constStaticVector{staticVector};
+    const auto& constSmallVector{smallVector};
+    CHECK(9 == sum(values));
+    CHECK(32 == sum(array));
+    CHECK(603 == sum(vector));
+    CHECK(603 == sum(constVector));
+    CHECK(6003 == sum(staticVector));
+    CHECK(6003 == sum(constStaticVector));
+    CHECK(60003 == sum(smallVector));
+    CHECK(60003 == sum(constSmallVector));
+    CHECK(9 == sum(container::Span<int>{values}));
+}
+
+// -----------------------------------------------------------------------------
+void testParts()
+{
+    int values[]{0, 1, 2, 3, 4, 5, 6, 7};
+    const container::Span<int> span{values};
+
+    // Parts within the span.
+    CHECK(views(span.subspan(0U), values, 8U));
+    CHECK(views(span.subspan(3U), values + 3U, 5U));
+    CHECK(views(span.subspan(2U, 4U), values + 2U, 4U));
+    CHECK(views(span.subspan(7U, 1U), values + 7U, 1U));
+    CHECK(views(span.first(3U), values, 3U));
+    CHECK(views(span.last(3U), values + 5U, 3U));
+    CHECK(views(span.first(8U), values, 8U));
+    CHECK(views(span.last(8U), values, 8U));
+
+    // Empty parts.
+    CHECK(span.subspan(2U, 0U).empty());
+    CHECK(span.first(0U).empty());
+    CHECK(span.last(0U).empty());
+
+    // Parts are truncated at the end of the span.
+    CHECK(views(span.subspan(5U, 10U), values + 5U, 3U));
+    CHECK(views(span.subspan(5U, SIZE_MAX), values + 5U, 3U));
+    CHECK(views(span.first(100U), values, 8U));
+    CHECK(views(span.last(100U), values, 8U));
+    CHECK(views(span.first(SIZE_MAX), values, 8U));
+    CHECK(views(span.last(SIZE_MAX), values, 8U));
+
+    // Offsets at or past the end yield an empty span.
+    CHECK(views(span.subspan(8U), static_cast<int*>(nullptr), 0U));
+    CHECK(views(span.subspan(9U, 1U), static_cast<int*>(nullptr), 0U));
+    CHECK(views(span.subspan(SIZE_MAX, SIZE_MAX), static_cast<int*>(nullptr), 0U));
+
+    // Parts of parts, and parts of empty spans.
+    CHECK(views(span.subspan(2U, 5U).last(2U).first(1U), values + 5U, 1U));
+    const container::Span<int> empty{};
+    CHECK(empty.subspan(0U).empty() && empty.first(3U).empty() && empty.last(3U).empty());
+
+    // Parts of read-only spans.
+    const container::Span<const int> readOnly{span};
+    CHECK(views(readOnly.subspan(1U, 2U), values + 1U, 2U));
+    CHECK(6 == readOnly.last(2U)[0U]);
+}
+} // namespace
+
+/**
+ * @brief Run the Span tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    testConstruction();
+    testConversions();
+    testParts();
+    return test::report();
+}
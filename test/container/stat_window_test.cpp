@@ -0,0 +1,56 @@
+/**
+ * @brief Host tests for container::StatWindow (host build only).
+ */
+#include <cmath>
+#include <vector>
+
+#include "container/stat_window.h"
+#include "test.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+template <typename T>
+void testStatWindow()
+{
+    constexpr size_t windowSize{16U};
+    container::StatWindow<T, windowSize> window{};
+    std::vector<double> reference{};
+
+    // Feed a signal with a large, stepwise increasing offset to provoke cancellation.
+    for (long i{}; i < 2000000L; ++i)
+    {
+        const auto offset{1000.0 + (i / 100000L) * 500.0};
+        const auto value{static_cast<T>(offset + test::random(1000U) / 1000.0)};
+        window.push(value);
+        reference.push_back(static_cast<double>(value));
+        if (reference.size() > windowSize) { reference.erase(reference.begin()); }
+        if (i % 997L != 0L) { continue; }
+
+        double mean{};
+        for (const auto& x : reference) { mean += x; }
+        mean /= reference.size();
+        double variance{};
+        for (const auto& x : reference) { variance += (x - mean) * (x - mean); }
+        variance /= reference.size();
+
+        const double tolerance{sizeof(T) == sizeof(float) ? 1e-2 : 1e-8};
+        CHECK(std::abs(window.mean() - mean) <= tolerance * mean);
+        CHECK(std::abs(window.variance() - variance) <=
+              tolerance * (variance > 1.0 ? variance : 1.0));
+    }
+}
+} // namespace
+
+/**
+ * @brief Run the StatWindow tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    srand(1U);
+    testStatWindow<float>();
+    testStatWindow<double>();
+    return test::report();
+}
@@ -0,0 +1,66 @@
+/**
+ * @brief Host tests for the positional operations of container::Vector (host build only).
+ */
+#include <algorithm>
+#include <vector>
+
+#include "container/vector.h"
+#include "test.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+void testInsertAndErase(const size_t size)
+{
+    container::Vector<int> vector{};
+    std::vector<int> reference{};
+
+    for (size_t i{}; i < size; ++i)
+    {
+        const auto value{static_cast<int>(test::random(1000U))};
+        const auto position{test::random(reference.size() + 1U)};
+        CHECK(vector.insert(position, value));
+        reference.insert(reference.begin() + static_cast<long>(position), value);
+    }
+
+    if (reference.size() > 2U)
+    {
+        const auto first{test::random(reference.size())};
+        const auto last{first + test::random(reference.size() - first + 1U)};
+        CHECK(vector.erase(first, last));
+        reference.erase(reference.begin() + static_cast<long>(first),
+                        reference.begin() + static_cast<long>(last));
+    }
+
+    // Insert a range of the vector into itself.
+    if (reference.size() > 1U)
+    {
+        const auto count{test::random(reference.size()) + 1U};
+        const auto position{test::random(reference.size() + 1U)};
+        const std::vector<int> range(reference.begin(), reference.begin() + static_cast<long>(count));
+        CHECK(vector.insert(position, vector.data(), vector.data() + count));
+        reference.insert(reference.begin() + static_cast<long>(position), range.begin(), range.end());
+    }
+
+    auto isMultipleOfThree{[](const int value) { return value % 3 == 0; }};
+    const auto sizeBefore{reference.size()};
+    reference.erase(std::remove_if(reference.begin(), reference.end(), isMultipleOfThree),
+                    reference.end());
+    CHECK(vector.eraseIf(isMultipleOfThree) == sizeBefore - reference.size());
+
+    CHECK(vector.size() == reference.size());
+    for (size_t i{}; i < reference.size(); ++i) { CHECK(vector[i] == reference[i]); }
+}
+} // namespace
+
+/**
+ * @brief Run the Vector tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    srand(1U);
+    for (unsigned round{}; round < 2000U; ++round) { testInsertAndErase(test::random(200U)); }
+    return test::report();
+}
@@ -0,0 +1,55 @@
+#!/bin/sh
+# Regression test for the coefficient export tool (host build only).
+#
+# Usage: test/linreg_export_test.sh <path to linreg_export>
+#
+# A diverging training run and coefficients outside the fixed-point range must exit non-zero
+# without writing the header, invalid options must be rejected, and a converging run must
+# write the header.
+set -u
+
+tool=${1:?"Usage: $0 <path to linreg_export>"}
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+failures=0
+
+fail() { echo "check failed: $1"; failures=$((failures + 1)); }
+
+# Check that given option value is rejected with the usage message, i.e. before training.
+rejects() {
+    "$tool" "$dir/converge.csv" --csv "$1" "$2" -o "$dir/option.h" 2>&1 | grep -q "^Usage:"
+}
+
+# y = 3x + 5 for x = 0..999 diverges with the default learning rate, x / 1000 converges.
+awk 'BEGIN { print "x,y"; for (i = 0; i < 1000; i++) print i "," 3 * i + 5 }' > "$dir/diverge.csv"
+awk 'BEGIN { print "x,y"; for (i = 0; i < 1000; i++) print i / 1000 "," 3 * i / 1000 + 5 }' > "$dir/converge.csv"
+
+if "$tool" "$dir/diverge.csv" --csv -o "$dir/diverge.h" > /dev/null 2>&1; then
+    fail "diverging run exited with status 0"
+fi
+[ -e "$dir/diverge.h" ] && fail "diverging run wrote a header"
+
+for threads in -1 8x 99999999999 ""; do
+    rejects -t "$threads" || fail "thread count '$threads' accepted"
+done
+for rate in foo 0 -0.5 nan inf 0.5x ""; do
+    rejects -r "$rate" || fail "learning rate '$rate' accepted"
+done
+for epochs in abc 0 -5 10x 99999999999 ""; do
+    rejects -e "$epochs" || fail "epoch count '$epochs' accepted"
+done
+[ -e "$dir/option.h" ] && fail "invalid option wrote a header"
+
+# Coefficients of 2^32 converge but don't fit the 32-bit fixed-point format.
+awk 'BEGIN { print "x,y"; for (i = 0; i < 10; i++) print "1,8589934592" }' > "$dir/huge.csv"
+if "$tool" "$dir/huge.csv" --csv -o "$dir/huge.h" > /dev/null 2>&1; then
+    fail "out-of-range coefficients exited with status 0"
+fi
+[ -e "$dir/huge.h" ] && fail "out-of-range coefficients wrote a header"
+
+"$tool" "$dir/converge.csv" --csv -t 2 -r 0.5 -e 100000 -o "$dir/converge.h" > /dev/null 2>&1 ||
+    fail "converging run exited with non-zero status"
+[ -s "$dir/converge.h" ] || fail "converging run wrote no header"
+
+if [ "$failures" -eq 0 ]; then echo "PASSED: 0 failed checks"; else echo "FAILED: $failures failed checks"; fi
+[ "$failures" -eq 0 ]
@@ -0,0 +1,234 @@
+/**
+ * @brief Host tests for ml::host::ChunkReader (host build only).
+ */
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "ml/host/chunk_reader.h"
+#include "ml/host/dataset.h"
+#include "temp_file.h"
+#include "test.h"
+
+namespace
+{
+/**
+ * @brief Input/output pairs read from or written to a file.
+ */
+struct Rows
+{
+    std::vector<double> input;
+    std::vector<double> output;
+};
+
+/**
+ * @brief Read given number of chunks (default = all), check that no chunk exceeds the chunk size.
+ */
+Rows readChunks(ml::host::ChunkReader& reader, const size_t chunkCount = SIZE_MAX)
+{
+    Rows rows{};
+    ml::host::Chunk chunk{};
+    for (size_t i{}; (i < chunkCount) && reader.next(chunk); ++i)
+    {
+        CHECK((0U < chunk.size) && (chunk.size <= reader.chunkSize()));
+        rows.input.insert(rows.input.end(), chunk.input, chunk.input + chunk.size);
+        rows.output.insert(rows.output.end(), chunk.output, chunk.output + chunk.size);
+    }
+    return rows;
+}
+
+/**
+ * @brief Check that the rows read match the reference rows.
+ */
+void checkRows(const Rows& rows, const Rows& reference)
+{
+    CHECK(rows.input.size() == reference.input.size());
+    CHECK(rows.output.size() == reference.output.size());
+    CHECK(rows.input == reference.input);
+    CHECK(rows.output == reference.output);
+}
+
+/**
+ * @brief Create CSV text holding valid rows mixed with lines that must be skipped.
+ *
+ *        The rows are written as "output,unused,input" to check the column selection.
+ *
+ * @param[out] reference The valid rows in file order.
+ * @param[out] malformedCount The number of lines to skip.
+ *
+ * @return The CSV text.
+ */
+std::string createCsv(Rows& reference, size_t& malformedCount)
+{
+    std::string text{"output,unused,input\n"};
+    malformedCount = 1U;
+
+    for (int i{}; i < 100; ++i)
+    {
+        const auto input{i * 0.5}, output{3.0 * i + 5.0};
+        text += std::to_string(output) + ",x," + std::to_string(input) + "\n";
+        reference.input.push_back(std::stod(std::to_string(input)));
+        reference.output.push_back(std::stod(std::to_string(output)));
+
+        if (10 == i)
+        {
+            // A line longer than the line buffer, whose tail would parse as a bogus row.
+            text += std::string(600U, '0') + "1,0,2\n";
+            ++malformedCount;
+        }
+        else if (20 == i)
+        {
+            text += "abc,0,def\n\n1,2\n";
+            malformedCount += 3U;
+        }
+    }
+
+    // A line filling the line buffer up to its newline is still a valid row.
+    const auto longInput{std::string(506U, '0') + "7"};
+    text += "9,0," + longInput + "\n";
+    reference.input.push_back(7.0);
+    reference.output.push_back(9.0);
+
+    // The last line doesn't need a terminating newline.
+    text += "11,0,4";
+    reference.input.push_back(4.0);
+    reference.output.push_back(11.0);
+    return text;
+}
+
+// -----------------------------------------------------------------------------
+void testCsv()
+{
+    test::TempFile file{};
+    Rows reference{};
+    size_t malformedCount{};
+    CHECK(file.write(createCsv(reference, malformedCount)));
+
+    for (const size_t chunkSize : {1U, 7U, 64U, 1000U})
+    {
+        ml::host::ChunkReader reader{chunkSize};
+        CHECK(reader.open(file.path(), ml::host::ChunkReader::Format::Csv, 2U, 0U));
+        CHECK(reader.isOpen() && (reader.chunkSize() == chunkSize));
+        checkRows(readChunks(reader), reference);
+        CHECK(reader.malformedCount() == malformedCount);
+
+        // The end of the file is reported repeatedly.
+        ml::host::Chunk chunk{};
+        CHECK(!reader.next(chunk));
+    }
+}
+
+// -----------------------------------------------------------------------------
+void testRewind()
+{
+    test::TempFile file{};
+    Rows reference{};
+    size_t malformedCount{};
+    CHECK(file.write(createCsv(reference, malformedCount)));
+    ml::host::ChunkReader reader{8U};
+    CHECK(reader.open(file.path(), ml::host::ChunkReader::Format::Csv, 2U, 0U));
+
+    // Rewinding before the first chunk has no effect.
+    CHECK(reader.rewind());
+    checkRows(readChunks(reader), reference);
+
+    // Rewind mid-stream, after the first chunk and while the second chunk is prefetched.
+    for (const size_t chunkCount : {1U, 3U, 12U})
+    {
+        CHECK(reader.rewind());
+        const auto partial{readChunks(reader, chunkCount)};
+        CHECK(partial.input.size() == chunkCount * reader.chunkSize());
+        CHECK(reader.rewind());
+        checkRows(readChunks(reader), reference);
+        CHECK(reader.malformedCount() == malformedCount);
+    }
+
+    // Rewinding at the end of the file restarts reading.
+    CHECK(reader.rewind());
+    checkRows(readChunks(reader), reference);
+
+    reader.close();
+    CHECK(!reader.isOpen() && !reader.rewind());
+    ml::host::Chunk chunk{};
+    CHECK(!reader.next(chunk));
+}
+
+// -----------------------------------------------------------------------------
+void testBinary()
+{
+    // Float input and double output columns, preceded by an unused column.
+    constexpr size_t rowCount{95U};
+    std::vector<double> unused(rowCount), output(rowCount);
+    std::vector<float> input(rowCount);
+    Rows reference{};
+    for (size_t i{}; i < rowCount; ++i)
+    {
+        input[i]  = static_cast<float>(i) * 0.5F;
+        output[i] = 2.0 * static_cast<double>(i) - 1.0;
+        reference.input.push_back(static_cast<double>(input[i]));
+        reference.output.push_back(output[i]);
+    }
+    const ml::host::ColumnView columns[]{
+        {unused.data(), rowCount, ml::host::ColumnType::Float64},
+        {input.data(), rowCount, ml::host::ColumnType::Float32},
+        {output.data(), rowCount, ml::host::ColumnType::Float64}};
+    test::TempFile file{};
+    CHECK(ml::host::Dataset::write(file.path(), columns, 3U));
+
+    ml::host::ChunkReader reader{10U};
+    CHECK(reader.open(file.path(), ml::host::ChunkReader::Format::Binary, 1U, 2U));
+    checkRows(readChunks(reader), reference);
+    CHECK(0U == reader.malformedCount());
+
+    CHECK(reader.rewind());
+    CHECK(readChunks(reader, 2U).input.size() == 20U);
+    CHECK(reader.rewind());
+    checkRows(readChunks(reader), reference);
+
+    // Columns that don't exist are rejected.
+    CHECK(!reader.open(file.path(), ml::host::ChunkReader::Format::Binary, 0U, 3U));
+    CHECK(!reader.isOpen());
+}
+
+// -----------------------------------------------------------------------------
+void testOpenFailures()
+{
+    test::TempFile csv{};
+    CHECK(csv.write(std::string{"1,2\n3,4\n"}));
+
+    ml::host::ChunkReader reader{16U};
+    CHECK(!reader.open(nullptr, ml::host::ChunkReader::Format::Csv));
+    CHECK(!reader.open("/nonexistent/data.csv", ml::host::ChunkReader::Format::Csv));
+    CHECK(!reader.open(csv.path(), ml::host::ChunkReader::Format::Binary));
+    CHECK(!reader.open(csv.path(), ml::host::ChunkReader::Format::Count));
+    CHECK(!reader.isOpen());
+
+    // Chunk buffers that can't be allocated are reported rather than terminating.
+    ml::host::ChunkReader huge{SIZE_MAX / 4U};
+    CHECK(!huge.open(csv.path(), ml::host::ChunkReader::Format::Csv));
+    CHECK(!huge.isOpen());
+
+    // A failed open leaves the reader usable.
+    CHECK(reader.open(csv.path(), ml::host::ChunkReader::Format::Csv));
+    checkRows(readChunks(reader), Rows{{1.0, 3.0}, {2.0, 4.0}});
+
+    // A zero chunk size is raised to one.
+    ml::host::ChunkReader single{0U};
+    CHECK(single.chunkSize() == 1U);
+}
+} // namespace
+
+/**
+ * @brief Run the chunk reader tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    testCsv();
+    testRewind();
+    testBinary();
+    testOpenFailures();
+    return test::report();
+}
@@ -0,0 +1,199 @@
+/**
+ * @brief Host tests for ml::host::Dataset (host build only).
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+#include "ml/host/dataset.h"
+#include "temp_file.h"
+#include "test.h"
+
+namespace
+{
+/** Byte offsets of the fields of a dataset file, see dataset.cpp. */
+constexpr size_t versionOffset{4U};
+constexpr size_t columnCountOffset{6U};
+constexpr size_t rowCountOffset{8U};
+constexpr size_t descriptorOffset{32U};
+constexpr size_t descriptorSize{16U};
+
+/** The number of rows of the test dataset, odd to require padding between the columns. */
+constexpr size_t rowCount{37U};
+
+/**
+ * @brief Write a dataset with a float column followed by a double column.
+ */
+bool writeDataset(const test::TempFile& file, std::vector<float>& floats,
+                  std::vector<double>& doubles)
+{
+    floats.clear();
+    doubles.clear();
+    for (size_t i{}; i < rowCount; ++i)
+    {
+        floats.push_back(static_cast<float>(i) * 0.25F);
+        doubles.push_back(3.0 * static_cast<double>(i) + 0.1);
+    }
+    const ml::host::ColumnView columns[]{
+        {floats.data(), floats.size(), ml::host::ColumnType::Float32},
+        {doubles.data(), doubles.size(), ml::host::ColumnType::Float64}};
+    return ml::host::Dataset::write(file.path(), columns, 2U);
+}
+
+/**
+ * @brief Write given bytes to the file and check whether the dataset loader accepts them.
+ */
+bool opens(const test::TempFile& file, const std::vector<unsigned char>& data)
+{
+    ml::host::Dataset dataset{};
+    CHECK(file.write(data.data(), data.size()));
+    const auto opened{dataset.open(file.path())};
+    CHECK(opened == dataset.isOpen());
+    return opened;
+}
+
+// -----------------------------------------------------------------------------
+void testRoundTrip()
+{
+    test::TempFile file{};
+    std::vector<float> floats{};
+    std::vector<double> doubles{};
+    CHECK(writeDataset(file, floats, doubles));
+
+    ml::host::Dataset dataset{};
+    CHECK(dataset.open(file.path()));
+    CHECK(dataset.isOpen());
+    CHECK(dataset.rowCount() == rowCount);
+    CHECK(dataset.columnCount() == 2U);
+
+    const auto input{dataset.column(0U)};
+    const auto output{dataset.column(1U)};
+    CHECK((input.type == ml::host::ColumnType::Float32) && (input.size == rowCount));
+    CHECK((output.type == ml::host::ColumnType::Float64) && (output.size == rowCount));
+    CHECK((nullptr == input.asDouble()) && (nullptr == output.asFloat()));
+
+    // The columns are mapped in place, hence must be aligned to their value size.
+    CHECK(0U == reinterpret_cast<uintptr_t>(input.data) % alignof(float));
+    CHECK(0U == reinterpret_cast<uintptr_t>(output.data) % alignof(double));
+    if ((nullptr != input.asFloat()) && (nullptr != output.asDouble()))
+    {
+        CHECK(0 == memcmp(input.asFloat(), floats.data(), rowCount * sizeof(float)));
+        CHECK(0 == memcmp(output.asDouble(), doubles.data(), rowCount * sizeof(double)));
+    }
+
+    // Columns out of range yield an empty view.
+    const auto invalid{dataset.column(2U)};
+    CHECK((nullptr == invalid.data) && (0U == invalid.size));
+    CHECK(invalid.type == ml::host::ColumnType::Count);
+
+    dataset.close();
+    CHECK(!dataset.isOpen() && (0U == dataset.rowCount()) && (0U == dataset.columnCount()));
+}
+
+// -----------------------------------------------------------------------------
+void testInvalidFiles()
+{
+    test::TempFile file{}, corrupt{};
+    std::vector<float> floats{};
+    std::vector<double> doubles{};
+    CHECK(writeDataset(file, floats, doubles));
+    const auto valid{file.read()};
+    CHECK(opens(corrupt, valid));
+
+    ml::host::Dataset dataset{};
+    CHECK(!dataset.open(nullptr));
+    CHECK(!dataset.open("/nonexistent/dataset.lrds"));
+
+    // Every truncation must be rejected, down to an empty file.
+    for (size_t size{}; size < valid.size(); ++size)
+    {
+        const std::vector<unsigned char> truncated(valid.begin(), valid.begin() + size);
+        CHECK(!opens(corrupt, truncated));
+    }
+
+    // Invalid header fields.
+    auto data{valid};
+    data[0U] = 'X';
+    CHECK(!opens(corrupt, data));
+
+    data = valid;
+    data[versionOffset] = 2U;
+    CHECK(!opens(corrupt, data));
+
+    data = valid;
+    data[columnCountOffset] = 0U;
+    CHECK(!opens(corrupt, data));
+
+    // More columns than descriptors fitting in the file.
+    data = valid;
+    data[columnCountOffset]      = 0xFFU;
+    data[columnCountOffset + 1U] = 0xFFU;
+    CHECK(!opens(corrupt, data));
+
+    // More rows than the column blocks hold.
+    data = valid;
+    data[rowCountOffset] = static_cast<unsigned char>(rowCount + 1U);
+    CHECK(!opens(corrupt, data));
+
+    data = valid;
+    for (size_t i{}; i < sizeof(uint64_t); ++i) { data[rowCountOffset + i] = 0xFFU; }
+    CHECK(!opens(corrupt, data));
+
+    // Invalid descriptors, i.e. an unknown type, a misaligned offset and an offset past the end.
+    const auto secondDescriptor{descriptorOffset + descriptorSize};
+    data = valid;
+    data[secondDescriptor] = static_cast<unsigned char>(ml::host::ColumnType::Count);
+    CHECK(!opens(corrupt, data));
+
+    data = valid;
+    data[secondDescriptor + 8U] += 4U;
+    CHECK(!opens(corrupt, data));
+
+    data = valid;
+    data[secondDescriptor + 15U] = 0x80U;
+    CHECK(!opens(corrupt, data));
+
+    // Trailing bytes are allowed.
+    data = valid;
+    data.push_back(0U);
+    CHECK(opens(corrupt, data));
+}
+
+// -----------------------------------------------------------------------------
+void testInvalidWrites()
+{
+    test::TempFile file{};
+    const float floats[]{1.0F, 2.0F};
+    const double doubles[]{1.0, 2.0, 3.0};
+
+    // Columns of different sizes, an invalid type and missing data are rejected.
+    const ml::host::ColumnView sizeMismatch[]{{floats, 2U, ml::host::ColumnType::Float32},
+                                              {doubles, 3U, ml::host::ColumnType::Float64}};
+    CHECK(!ml::host::Dataset::write(file.path(), sizeMismatch, 2U));
+
+    const ml::host::ColumnView invalidType[]{{doubles, 3U, ml::host::ColumnType::Count}};
+    CHECK(!ml::host::Dataset::write(file.path(), invalidType, 1U));
+
+    const ml::host::ColumnView missingData[]{{nullptr, 3U, ml::host::ColumnType::Float64}};
+    CHECK(!ml::host::Dataset::write(file.path(), missingData, 1U));
+
+    CHECK(!ml::host::Dataset::write(file.path(), sizeMismatch, 0U));
+    CHECK(!ml::host::Dataset::write(nullptr, sizeMismatch, 1U));
+    CHECK(!ml::host::Dataset::write(file.path(), nullptr, 1U));
+    CHECK(!ml::host::Dataset::write("/nonexistent/dataset.lrds", sizeMismatch, 1U));
+}
+} // namespace
+
+/**
+ * @brief Run the dataset tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    testRoundTrip();
+    testInvalidFiles();
+    testInvalidWrites();
+    return test::report();
+}
@@ -0,0 +1,93 @@
+/**
+ * @brief Host tests for the vectorized training kernels (host build only).
+ */
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "ml/host/kernels.h"
+#include "test.h"
+
+namespace
+{
+/**
+ * @brief Check whether two values are equal within given relative tolerance.
+ */
+bool isClose(const double x, const double y, const double tolerance = 1e-9) noexcept
+{
+    return std::abs(x - y) <= tolerance * (std::abs(y) > 1.0 ? std::abs(y) : 1.0);
+}
+
+// -----------------------------------------------------------------------------
+void testKernelSums()
+{
+    constexpr double weight{2.5}, bias{0.3};
+
+    // Odd sizes exercise the scalar tail of the vectorized kernels.
+    for (const size_t count : {0U, 1U, 3U, 7U, 64U, 1001U})
+    {
+        std::vector<double> input(count), reference(count), output(count);
+        double errorSum{}, weightedErrorSum{}, squaredErrorSum{}, maxAbsError{};
+
+        for (size_t i{}; i < count; ++i)
+        {
+            input[i]     = static_cast<double>(rand()) / RAND_MAX;
+            reference[i] = 3.0 * input[i] - 1.0 + (static_cast<int>(rand() % 100) - 50) * 1e-3;
+            const auto error{reference[i] - (weight * input[i] + bias)};
+            errorSum         += error;
+            weightedErrorSum += error * input[i];
+            squaredErrorSum  += error * error;
+            if (std::abs(error) > maxAbsError) { maxAbsError = std::abs(error); }
+        }
+
+        const auto sums{ml::host::kernels::gradientSums(input.data(), reference.data(), count,
+                                                        weight, bias)};
+        CHECK(!sums.nonFinite);
+        CHECK(isClose(sums.errorSum, errorSum));
+        CHECK(isClose(sums.weightedErrorSum, weightedErrorSum));
+        CHECK(isClose(sums.squaredErrorSum, squaredErrorSum));
+        CHECK(sums.maxAbsError == maxAbsError);
+        CHECK(isClose(ml::host::kernels::sumSquaredError(input.data(), reference.data(), count,
+                                                         weight, bias), squaredErrorSum));
+
+        ml::host::kernels::predict(input.data(), output.data(), count, weight, bias);
+        for (size_t i{}; i < count; ++i) { CHECK(isClose(output[i], weight * input[i] + bias)); }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void testKernelNonFinite()
+{
+    constexpr size_t count{37U};
+    const double nonFinite[]{std::numeric_limits<double>::quiet_NaN(),
+                             std::numeric_limits<double>::infinity(),
+                             -std::numeric_limits<double>::infinity()};
+
+    // Place the value at every position, i.e. in both the vectorized body and the tail.
+    for (const auto value : nonFinite)
+    {
+        for (size_t position{}; position < count; ++position)
+        {
+            std::vector<double> input(count, 1.0), reference(count, 2.0);
+            reference[position] = value;
+            const auto sums{ml::host::kernels::gradientSums(input.data(), reference.data(),
+                                                            count, 1.0, 0.0)};
+            CHECK(sums.nonFinite);
+        }
+    }
+}
+} // namespace
+
+/**
+ * @brief Run the kernel tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    srand(1U);
+    printf("Instruction set: %s\n", ml::host::kernels::instructionSet());
+    testKernelSums();
+    testKernelNonFinite();
+    return test::report();
+}
@@ -0,0 +1,73 @@
+/**
+ * @brief Host tests for ml::host::ParallelTrainer (host build only).
+ */
+#include <cmath>
+#include <vector>
+
+#include "ml/host/parallel_trainer.h"
+#include "test.h"
+
+namespace
+{
+/**
+ * @brief Check whether two values are equal within given relative tolerance.
+ */
+bool isClose(const double x, const double y, const double tolerance = 1e-9) noexcept
+{
+    return std::abs(x - y) <= tolerance * (std::abs(y) > 1.0 ? std::abs(y) : 1.0);
+}
+
+// -----------------------------------------------------------------------------
+void testTrainerDivergence()
+{
+    // Unnormalized inputs make the gradient descent diverge, the coefficients become NaN.
+    constexpr size_t count{1000U};
+    std::vector<double> input(count), output(count);
+    for (size_t i{}; i < count; ++i)
+    {
+        input[i]  = static_cast<double>(i);
+        output[i] = 3.0 * input[i] + 5.0;
+    }
+
+    for (const unsigned threadCount : {1U, 4U})
+    {
+        ml::host::ParallelTrainer trainer{input.data(), output.data(), count, threadCount};
+        CHECK(!trainer.train(0.5, 100000U));
+        CHECK(trainer.getEpochsUsed() < 100000);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void testTrainerConvergence()
+{
+    constexpr size_t count{1000U};
+    std::vector<double> input(count), output(count);
+    for (size_t i{}; i < count; ++i)
+    {
+        input[i]  = i / static_cast<double>(count);
+        output[i] = 3.0 * input[i] + 5.0;
+    }
+
+    // The result must not depend on the thread count beyond rounding of the reduction.
+    for (const unsigned threadCount : {1U, 3U, 4U})
+    {
+        ml::host::ParallelTrainer trainer{input.data(), output.data(), count, threadCount};
+        CHECK(trainer.train(0.5, 200000U));
+        CHECK(isClose(trainer.getWeight(), 3.0, 1e-3));
+        CHECK(isClose(trainer.getBias(), 5.0, 1e-3));
+        CHECK(std::isfinite(trainer.meanSquaredError()));
+    }
+}
+} // namespace
+
+/**
+ * @brief Run the parallel trainer tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    testTrainerDivergence();
+    testTrainerConvergence();
+    return test::report();
+}
@@ -0,0 +1,140 @@
+/**
+ * @brief Host tests for ml::host::StreamTrainer (host build only).
+ */
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "ml/host/chunk_reader.h"
+#include "ml/host/dataset.h"
+#include "ml/host/stream_trainer.h"
+#include "temp_file.h"
+#include "test.h"
+
+namespace
+{
+/**
+ * @brief Check whether two values are equal within given absolute tolerance.
+ */
+bool isClose(const double x, const double y, const double tolerance) noexcept
+{
+    return std::abs(x - y) <= tolerance;
+}
+
+/**
+ * @brief Write the samples of y = 3x + 5 as CSV, x scaled by given factor.
+ */
+bool writeCsv(const test::TempFile& file, const size_t count, const double scale)
+{
+    std::string text{"x,y\n"};
+    for (size_t i{}; i < count; ++i)
+    {
+        const auto x{static_cast<double>(i) * scale};
+        text += std::to_string(x) + "," + std::to_string(3.0 * x + 5.0) + "\n";
+    }
+    return file.write(text);
+}
+
+// -----------------------------------------------------------------------------
+void testMiniBatch()
+{
+    test::TempFile file{};
+    CHECK(writeCsv(file, 1000U, 0.001));
+    ml::host::ChunkReader reader{64U};
+    CHECK(reader.open(file.path(), ml::host::ChunkReader::Format::Csv));
+
+    ml::host::StreamTrainer trainer{};
+    CHECK(trainer.trainMiniBatch(reader, 0.5, 500U));
+    CHECK(500 == trainer.getEpochsUsed());
+    CHECK(isClose(trainer.getWeight(), 3.0, 1e-2));
+    CHECK(isClose(trainer.getBias(), 5.0, 1e-2));
+    CHECK(isClose(trainer.predict(0.5), 6.5, 1e-2));
+    CHECK(trainer.meanSquaredError() < 1e-4);
+
+    // The header line is skipped on every epoch, not accumulated.
+    CHECK(1U == reader.malformedCount());
+}
+
+// -----------------------------------------------------------------------------
+void testOnline()
+{
+    // Train from a binary dataset with a float input column.
+    constexpr size_t count{500U};
+    std::vector<float> input(count);
+    std::vector<double> output(count);
+    for (size_t i{}; i < count; ++i)
+    {
+        input[i]  = static_cast<float>(i) / count;
+        output[i] = 3.0 * static_cast<double>(input[i]) + 5.0;
+    }
+    const ml::host::ColumnView columns[]{{input.data(), count, ml::host::ColumnType::Float32},
+                                         {output.data(), count, ml::host::ColumnType::Float64}};
+    test::TempFile file{};
+    CHECK(ml::host::Dataset::write(file.path(), columns, 2U));
+    ml::host::ChunkReader reader{32U};
+    CHECK(reader.open(file.path(), ml::host::ChunkReader::Format::Binary));
+
+    ml::host::StreamTrainer trainer{};
+    CHECK(trainer.trainOnline(reader, 0.05, 200U));
+    CHECK(200 == trainer.getEpochsUsed());
+    CHECK(isClose(trainer.getWeight(), 3.0, 1e-3));
+    CHECK(isClose(trainer.getBias(), 5.0, 1e-3));
+    CHECK(trainer.meanSquaredError() < 1e-6);
+}
+
+// -----------------------------------------------------------------------------
+void testDivergence()
+{
+    // Unnormalized inputs make both training methods diverge.
+    test::TempFile file{};
+    CHECK(writeCsv(file, 1000U, 1.0));
+    ml::host::ChunkReader reader{128U};
+    CHECK(reader.open(file.path(), ml::host::ChunkReader::Format::Csv));
+
+    ml::host::StreamTrainer miniBatch{};
+    CHECK(!miniBatch.trainMiniBatch(reader, 0.5, 10000U));
+    CHECK(miniBatch.getEpochsUsed() < 10000);
+
+    ml::host::StreamTrainer online{};
+    CHECK(!online.trainOnline(reader, 0.5, 10000U));
+    CHECK(online.getEpochsUsed() < 10000);
+}
+
+// -----------------------------------------------------------------------------
+void testInvalidArguments()
+{
+    test::TempFile file{}, empty{};
+    CHECK(writeCsv(file, 10U, 0.1));
+    CHECK(empty.write(std::string{"x,y\n"}));
+    ml::host::ChunkReader reader{4U};
+    ml::host::StreamTrainer trainer{};
+
+    // A closed reader, a non-positive learning rate and zero epochs are rejected.
+    CHECK(!trainer.trainMiniBatch(reader, 0.1, 10U));
+    CHECK(!trainer.trainOnline(reader, 0.1, 10U));
+    CHECK(reader.open(file.path(), ml::host::ChunkReader::Format::Csv));
+    CHECK(!trainer.trainMiniBatch(reader, 0.0, 10U));
+    CHECK(!trainer.trainOnline(reader, -0.1, 10U));
+    CHECK(!trainer.trainMiniBatch(reader, 0.1, 0U));
+    CHECK(!trainer.trainOnline(reader, 0.1, 0U));
+
+    // A file without samples is rejected.
+    CHECK(reader.open(empty.path(), ml::host::ChunkReader::Format::Csv));
+    CHECK(!trainer.trainMiniBatch(reader, 0.1, 10U));
+    CHECK(!trainer.trainOnline(reader, 0.1, 10U));
+}
+} // namespace
+
+/**
+ * @brief Run the stream trainer tests.
+ *
+ * @return 0 if all checks passed, 1 otherwise.
+ */
+int main()
+{
+    testMiniBatch();
+    testOnline();
+    testDivergence();
+    testInvalidArguments();
+    return test::report();
+}
@@ -0,0 +1,106 @@
+/**
+ * @brief Temporary files for the host I/O tests (host build only).
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+namespace test
+{
+/**
+ * @brief Temporary file, removed when the object is deleted.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class TempFile final
+{
+public:
+    /**
+     * @brief Create a new empty temporary file.
+     */
+    TempFile() noexcept
+    {
+        char path[]{"/tmp/ml_host_test_XXXXXX"};
+        const auto fd{mkstemp(path)};
+        if (0 <= fd)
+        {
+            ::close(fd);
+            myPath = path;
+        }
+    }
+
+    /**
+     * @brief Remove the temporary file.
+     */
+    ~TempFile() noexcept
+    {
+        if (!myPath.empty()) { remove(myPath.c_str()); }
+    }
+
+    /**
+     * @brief Get the path of the file.
+     *
+     * @return The path of the file, empty if the file couldn't be created.
+     */
+    const char* path() const noexcept { return myPath.c_str(); }
+
+    /**
+     * @brief Replace the content of the file.
+     *
+     * @param[in] data Pointer to the data to write.
+     * @param[in] size The number of bytes to write.
+     *
+     * @return True if the data was written, false otherwise.
+     */
+    bool write(const void* data, const size_t size) const noexcept
+    {
+        auto file{fopen(myPath.c_str(), "wb")};
+        if (nullptr == file) { return false; }
+        const auto written{(0U == size) || (size == fwrite(data, 1U, size, file))};
+        return (0 == fclose(file)) && written;
+    }
+
+    /**
+     * @brief Replace the content of the file with given text.
+     *
+     * @param[in] text The text to write.
+     *
+     * @return True if the text was written, false otherwise.
+     */
+    bool write(const std::string& text) const noexcept { return write(text.data(), text.size()); }
+
+    /**
+     * @brief Read the content of the file.
+     *
+     * @return The content of the file, empty if the file couldn't be read.
+     */
+    std::vector<unsigned char> read() const
+    {
+        std::vector<unsigned char> data{};
+        auto file{fopen(myPath.c_str(), "rb")};
+        if (nullptr == file) { return data; }
+        unsigned char block[4096U];
+        size_t count{};
+        while (0U < (count = fread(block, 1U, sizeof(block), file)))
+        {
+            data.insert(data.end(), block, block + count);
+        }
+        fclose(file);
+        return data;
+    }
+
+    TempFile(const TempFile&)            = delete; // No copy constructor.
+    TempFile(TempFile&&)                 = delete; // No move constructor.
+    TempFile& operator=(const TempFile&) = delete; // No copy assignment.
+    TempFile& operator=(TempFile&&)      = delete; // No move assignment.
+
+private:
+    /** The path of the file. */
+    std::string myPath;
+};
+} // namespace test
@@ -0,0 +1,52 @@
+/**
+ * @brief Minimal check framework for the host tests (host build only).
+ *
+ *        Each test program runs its checks from main() and returns report(), which prints the
+ *        number of failed checks and yields a non-zero exit status if any check failed.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace test
+{
+/** The number of failed checks. */
+inline unsigned failCount{0U};
+
+/**
+ * @brief Check given condition, print the location of the check if it doesn't hold.
+ */
+#define CHECK(condition)                                                            \
+    do                                                                              \
+    {                                                                               \
+        if (!(condition))                                                           \
+        {                                                                           \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);  \
+            test::failCount++;                                                      \
+        }                                                                           \
+    } while (0)
+
+/**
+ * @brief Get a pseudo-random value in the range [0, max).
+ *
+ *        The sequence is seeded by srand(), hence every run is reproducible.
+ *
+ * @param[in] max The upper bound of the range, must exceed 0.
+ *
+ * @return The random value.
+ */
+inline size_t random(const size_t max) noexcept { return static_cast<size_t>(rand()) % max; }
+
+/**
+ * @brief Print the test result.
+ *
+ * @return 0 if all checks passed, 1 otherwise, to be returned from main().
+ */
+inline int report() noexcept
+{
+    printf("%s: %u failed checks\n", failCount == 0U ? "PASSED" : "FAILED", failCount);
+    return failCount == 0U ? 0 : 1;
+}
+} // namespace test
@@ -9,7 +9,7 @@ namespace utils
 {
 // -----------------------------------------------------------------------------
 template <typename T1, typename T2>
-Pair<T1, T2>::Pair()
+Pair<T1, T2>::Pair() noexcept
     : first{}
     , second{} {}
 
@@ -31,13 +31,13 @@ Pair<T1, T2>::Pair(Pair<T1, T2>&& other) noexcept
     : first{other.first}
     , second{other.second} 
 {
-    other.first = {};
-    other.second = {};
+    other.first = T1{};
+    other.second = T2{};
 }
 
 // -----------------------------------------------------------------------------
 template <typename T1, typename T2>
-Pair<T1, T2>::Pair<T1, T2>& operator=(const Pair<T1, T2>& other) noexcept
+Pair<T1, T2>& Pair<T1, T2>::operator=(const Pair<T1, T2>& other) noexcept
 {
     first  = other.first;
     second = other.second;
@@ -46,12 +46,12 @@ Pair<T1, T2>::Pair<T1, T2>& operator=(const Pair<T1, T2>& other) noexcept
 
 // -----------------------------------------------------------------------------
 template <typename T1, typename T2>
-Pair<T1, T2>::Pair<T1, T2>& operator=(Pair<T1, T2>&& other) noexcept
+Pair<T1, T2>& Pair<T1, T2>::operator=(Pair<T1, T2>&& other) noexcept
 {
     first        = other.first;
     second       = other.second;
-    other.first  = {};
-    other.second = {};
+    other.first  = T1{};
+    other.second = T2{};
     return *this;
 }
 
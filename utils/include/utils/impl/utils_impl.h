@@ -31,7 +31,7 @@ constexpr void set(volatile T& reg, const uint8_t bit) noexcept
 
 // -----------------------------------------------------------------------------
 template <typename T, typename... Bits>
-constexpr void set(volatile T& reg, const uint8_t bit, const Bits&&... bits)  
+constexpr void set(volatile T& reg, const uint8_t bit, const Bits&&... bits) noexcept
 {
     static_assert(type_traits::is_unsigned<T>::value, "Invalid data type used for bit operation!");
     set(reg, bit);
@@ -125,8 +125,7 @@ template <typename T, typename... Args>
 inline T* newObject(Args&&... args) noexcept
 {
     auto block{newMemory<T>()};
-    if (block) { *block = T{forward<Args>(args)...}; }
-    return block;
+    return block ? construct(block, forward<Args>(args)...) : nullptr;
 }
 
 // -----------------------------------------------------------------------------
@@ -153,11 +152,95 @@ inline void deleteMemory(T* &block) noexcept
 
 // -----------------------------------------------------------------------------
 template <typename T>
-inline T move(T&& source) noexcept
+inline void deleteObject(T* &object) noexcept
 {
-    T copy{source};
-    source = {};
-    return copy;
+    if (nullptr != object) { destroy(object); }
+    deleteMemory(object);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, typename... Args>
+inline T* construct(T* address, Args&&... args) noexcept
+{
+    return new (address) T(forward<Args>(args)...);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+inline void destroy(T* first, const size_t count) noexcept
+{
+    if constexpr (!type_traits::is_trivially_copyable<T>::value)
+    {
+        for (size_t i{}; i < count; ++i) { first[i].~T(); }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+inline void copyValues(T* destination, const T* source, const size_t count) noexcept
+{
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        if (count > 0U) { memcpy(destination, source, count * sizeof(T)); }
+        return;
+    }
+    for (size_t i{}; i < count; ++i) { destination[i] = source[i]; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+inline void moveValues(T* destination, T* source, const size_t count) noexcept
+{
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        if (count > 0U) { memmove(destination, source, count * sizeof(T)); }
+        return;
+    }
+
+    // Move forward when moving down, backward when moving up, to handle overlapping ranges.
+    if (destination < source)
+    {
+        for (size_t i{}; i < count; ++i) { destination[i] = utils::move(source[i]); }
+    }
+    else if (destination > source)
+    {
+        for (size_t i{count}; i > 0U; --i) { destination[i - 1U] = utils::move(source[i - 1U]); }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+inline void fillValues(T* destination, const T& value, const size_t count) noexcept
+{
+    if constexpr (type_traits::is_trivially_copyable<T>::value)
+    {
+        const auto bytes{reinterpret_cast<const uint8_t*>(&value)};
+        bool isZero{true};
+
+        for (size_t i{}; i < sizeof(T); ++i) { isZero = isZero && (bytes[i] == 0U); }
+        if ((sizeof(T) == 1U) || isZero)
+        {
+            if (count > 0U) { memset(destination, bytes[0U], count * sizeof(T)); }
+            return;
+        }
+    }
+    for (size_t i{}; i < count; ++i) { destination[i] = value; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr typename RemoveReference<T>::type&& move(T&& object) noexcept
+{
+    return static_cast<typename RemoveReference<T>::type&&>(object);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+constexpr void swap(T& x, T& y) noexcept
+{
+    T temp{move(x)};
+    x = move(y);
+    y = move(temp);
 }
 
 } // namespace utils
\ No newline at end of file
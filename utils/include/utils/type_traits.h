@@ -243,4 +243,114 @@ struct is_reference<T&>
     static const bool value{true};
 };
 
+/**
+ * @brief Check if given type is const qualified.
+ * 
+ * @tparam T The type to check.
+ */
+template <typename T>
+struct is_const
+{
+    // True for const types only.
+    static const bool value{false};
+};
+
+/**
+ * @brief Specialization for all const types.
+ * 
+ * @param[in] T The const type.
+ */
+template <typename T>
+struct is_const<const T>
+{
+    static const bool value{true};
+};
+
+/**
+ * @brief Check if given type is trivially copyable, i.e. if objects of the type can be copied
+ *        with memcpy and don't need to be destroyed.
+ * 
+ * @tparam T The type to check.
+ */
+template <typename T>
+struct is_trivially_copyable
+{
+    // True for trivially copyable types only.
+    static const bool value{__is_trivially_copyable(T)};
+};
+
+/**
+ * @brief Check if given type is trivial, i.e. trivially copyable and trivially default 
+ *        constructible, hence value initialization of the type sets all bits to zero.
+ * 
+ * @tparam T The type to check.
+ */
+template <typename T>
+struct is_trivial
+{
+    // True for trivial types only.
+    static const bool value{__is_trivial(T)};
+};
+
+/**
+ * @brief Check if given type is an enumeration, scoped or unscoped.
+ * 
+ * @tparam T The type to check.
+ */
+template <typename T>
+struct is_enum
+{
+    // True for enumeration types only.
+    static const bool value{__is_enum(T)};
+};
+
+/** 
+ * @brief Remove const qualification from given type.
+ * 
+ * @tparam T The type to remove const qualification from.
+ */
+template <typename T>
+struct remove_const
+{
+    // The type without const qualification.
+    using type = T;
+};
+
+/**
+ * @brief Specialization for all const types.
+ * 
+ * @param[in] T The const type.
+ */
+template <typename T>
+struct remove_const<const T>
+{
+    using type = T;
+};
+
+/** 
+ * @brief Select one of two types at compile time.
+ * 
+ * @tparam Condition The condition selecting the type.
+ * @tparam T The type selected if the condition is true.
+ * @tparam F The type selected if the condition is false.
+ */
+template <bool Condition, typename T, typename F>
+struct conditional
+{
+    // The selected type.
+    using type = T;
+};
+
+/**
+ * @brief Specialization for false conditions.
+ * 
+ * @param[in] T The type selected if the condition is true.
+ * @param[in] F The type selected if the condition is false.
+ */
+template <typename T, typename F>
+struct conditional<false, T, F>
+{
+    using type = F;
+};
+
 } // namespace type_traits
@@ -7,9 +7,25 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "utils/type_traits.h"
 
+#if __has_include(<new>)
+#include <new>
+#else
+/**
+ * @brief Placement new operator, constructs an object at given address.
+ * 
+ * @note avr-libc doesn't provide the <new> header, hence the declaration here.
+ *
+ * @param[in] address The address to construct the object at.
+ * 
+ * @return The given address.
+ */
+inline void* operator new(size_t, void* address) noexcept { return address; }
+#endif
+
 namespace utils 
 {
 /**
@@ -45,6 +61,28 @@ struct RemoveReference
     typedef T type;
 };
 
+/**
+ * @brief Specialization for lvalue references.
+ * 
+ * @tparam T The value type.
+ */
+template <typename T>
+struct RemoveReference<T&>
+{
+    typedef T type;
+};
+
+/**
+ * @brief Specialization for rvalue references.
+ * 
+ * @tparam T The value type.
+ */
+template <typename T>
+struct RemoveReference<T&&>
+{
+    typedef T type;
+};
+
 /**
  * @brief Maintain the value category of given object.
  *
@@ -273,18 +311,175 @@ template <typename T>
 inline void deleteMemory(T* &block) noexcept;
 
 /**
- * @brief Move memory from given source to a copy. 
+ * @brief Delete heap allocated object, i.e. call its destructor and deallocate it.
+ * 
+ *        Use for objects allocated via newObject. The pointer to the object is set to null 
+ *        after deallocation.
+ * 
+ * @tparam T The object type.
+ *
+ * @param[in] object Reference to the object to delete.
+ */
+template <typename T>
+inline void deleteObject(T* &object) noexcept;
+
+/**
+ * @brief Construct an object at given address via placement new.
+ *
+ * @tparam T The object type.
+ * @tparam Args The type of the arguments to pass to the constructor of T.
  * 
- * The copy will gain ownership of memory and the source instance will be emptied.
+ * @param[in] address The address to construct the object at. The memory must be 
+ *                    uninitialized, i.e. not hold a live object.
+ * @param[in] args The arguments to pass to the constructor of T.
+ * 
+ * @return A pointer to the new object.
+ */
+template <typename T, typename... Args>
+inline T* construct(T* address, Args&&... args) noexcept;
+
+/**
+ * @brief Destroy the objects in given range by calling their destructors.
+ * 
+ *        The memory isn't released. Nothing is done for trivially copyable types.
  *
- * @tparam T The type of source and the copy.
+ * @tparam T The object type.
+ * 
+ * @param[in] first Pointer to the first object to destroy.
+ * @param[in] count The number of objects to destroy (default = 1).
+ */
+template <typename T>
+inline void destroy(T* first, const size_t count = 1U) noexcept;
+
+/**
+ * @brief Copy values to a non-overlapping range of existing objects.
  * 
- * @param[in] source Reference to the source whose memory is moved.
+ *        Trivially copyable values are copied via memcpy, other values are assigned one by one.
+ *        Not usable in constant expressions, constexpr code shall copy element-wise instead.
  *
- * @return The copy of source.
+ * @tparam T The value type.
+ * 
+ * @param[in] destination Pointer to the first object to assign.
+ * @param[in] source      Pointer to the first value to copy.
+ * @param[in] count       The number of values to copy.
  */
 template <typename T>
-inline T move(T&& source) noexcept;
+inline void copyValues(T* destination, const T* source, const size_t count) noexcept;
+
+/**
+ * @brief Move values to a possibly overlapping range of existing objects.
+ * 
+ *        Trivially copyable values are moved via memmove, other values are move assigned one 
+ *        by one in the direction that doesn't overwrite values before they're moved.
+ *
+ * @tparam T The value type.
+ * 
+ * @param[in] destination Pointer to the first object to assign.
+ * @param[in] source      Pointer to the first value to move.
+ * @param[in] count       The number of values to move.
+ */
+template <typename T>
+inline void moveValues(T* destination, T* source, const size_t count) noexcept;
+
+/**
+ * @brief Assign given value to a range of existing objects.
+ * 
+ *        Trivially copyable values are set via memset if the value is a single byte or all 
+ *        bits are zero, else the value is assigned one by one.
+ *
+ * @tparam T The value type.
+ * 
+ * @param[in] destination Pointer to the first object to assign.
+ * @param[in] value       Reference to the value to assign.
+ * @param[in] count       The number of objects to assign.
+ */
+template <typename T>
+inline void fillValues(T* destination, const T& value, const size_t count) noexcept;
+
+/**
+ * @brief Cast given object to an rvalue, which enables its resources to be moved.
+ *
+ * @tparam T The type of the object.
+ * 
+ * @param[in] object Reference to the object whose resources are to be moved.
+ *
+ * @return The object as an rvalue reference.
+ */
+template <typename T>
+constexpr typename RemoveReference<T>::type&& move(T&& object) noexcept;
+
+/**
+ * @brief Swap the values of two objects by moving their resources.
+ *
+ * @tparam T The type of the objects.
+ * 
+ * @param[in] x Reference to the first object.
+ * @param[in] y Reference to the second object.
+ */
+template <typename T>
+constexpr void swap(T& x, T& y) noexcept;
+
+/**
+ * @brief Function object for less-than comparison, used as default ordering.
+ *
+ * @tparam T The type of the values to compare.
+ */
+template <typename T>
+struct Less
+{
+    /**
+     * @brief Check if given value is less than another value.
+     * 
+     * @param[in] x Reference to the first value.
+     * @param[in] y Reference to the second value.
+     * 
+     * @return True if x is less than y, false otherwise.
+     */
+    constexpr bool operator()(const T& x, const T& y) const noexcept { return x < y; }
+};
+
+/**
+ * @brief Function object for greater-than comparison, used for reverse ordering.
+ *
+ * @tparam T The type of the values to compare.
+ */
+template <typename T>
+struct Greater
+{
+    /**
+     * @brief Check if given value is greater than another value.
+     * 
+     * @param[in] x Reference to the first value.
+     * @param[in] y Reference to the second value.
+     * 
+     * @return True if x is greater than y, false otherwise.
+     */
+    constexpr bool operator()(const T& x, const T& y) const noexcept { return y < x; }
+};
+
+/**
+ * @brief Function object for hashing of integral and enumeration keys, used by hash maps.
+ *
+ *        The key value is used as hash as is, which spreads dense keys such as pin numbers 
+ *        and enumerators over consecutive slots without any collisions.
+ *
+ * @tparam T The key type. Must be an integral or enumeration type.
+ */
+template <typename T>
+struct Hash
+{
+    static_assert(type_traits::is_integral<T>::value || type_traits::is_enum<T>::value,
+                  "Hash is only implemented for integral and enumeration types!");
+
+    /**
+     * @brief Get the hash of given key.
+     * 
+     * @param[in] key Reference to the key.
+     * 
+     * @return The hash of the key.
+     */
+    constexpr size_t operator()(const T& key) const noexcept { return static_cast<size_t>(key); }
+};
 
 } // namespace utils
 